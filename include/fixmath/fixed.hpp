@@ -8,6 +8,7 @@
 #include <cstddef>      // for std::size_t
 #include <cstdint>      // for int64_t ...
 #include <string>       // for std::string
+#include <string_view>  // for std::string_view
 #include <limits>       // for std::numeric_limits
 #include <ostream>      // for std::basic_ostream
 #include <type_traits>  // for std::integral_constant, std::decay ...
@@ -19,6 +20,7 @@
 #include "fixmath_config.hpp"
 #include "fixmath_traits.inl"
 #include "fixmath_bitcast.inl"
+#include "fixmath_counters.inl"
 
 namespace fixmath {
 
@@ -109,4 +111,6 @@ private:
 } // namespace fixmath
 
 #include "fixed_impl.inl"
+#include "fixmath_int192.inl"
 #include "fixed_math.inl"
+#include "fixed_string.inl"
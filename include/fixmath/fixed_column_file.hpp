@@ -0,0 +1,70 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <cstdio>       // for std::FILE
+#include <cstring>      // for std::memcmp
+#include <span>         // for std::span
+#include <system_error> // for std::errc
+#include <vector>       // for std::vector
+#include "fixed.hpp"
+#include "fixmath_mmap.inl"
+
+namespace fixmath {
+
+// On-disk header of a column file; see docs/integration/column-files.md. All fields are
+// stored in the writer's byte order, which byte_order records.
+struct column_file_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint8_t raw_bytes;
+	uint8_t fraction_bits;
+	uint8_t arithmetic_mode;
+	uint8_t rounding_mode;
+	uint32_t column_count;
+	uint64_t directory_offset;
+};
+
+// Directory entry: byte offset of a column's raw payload from the start of the file, and its length in values.
+struct column_file_entry {
+	uint64_t offset;
+	uint64_t count;
+};
+
+constexpr char COLUMN_FILE_MAGIC[8] = {'F', 'I', 'X', 'M', 'A', 'T', 'H', 'C'};
+constexpr uint32_t COLUMN_FILE_VERSION = 1;
+constexpr uint32_t COLUMN_FILE_BYTE_ORDER = 0x01020304;
+constexpr uint64_t COLUMN_FILE_ALIGNMENT = 64;
+
+// Write every column as an aligned raw payload. Returns the errno-derived code of the first failed file operation.
+template <FixedPolicy policy>
+::std::errc write_column_file(const char* path, ::std::span<const ::std::span<const fixed<policy>>> columns);
+
+// Read-only view of a column file. Columns are spans into the mapping, so they stay
+// valid until the file is closed or destroyed.
+template <FixedPolicy policy>
+class column_file {
+public:
+	column_file() = default;
+	column_file(const column_file&) = delete;
+	column_file& operator=(const column_file&) = delete;
+
+	// Map and validate the file. Returns illegal_byte_sequence for a malformed or foreign-endian
+	// file and invalid_argument when the stored policy differs from policy.
+	::std::errc open(const char* path);
+	void close();
+
+	::std::size_t column_count() const { return columns_.size(); }
+	::std::span<const fixed<policy>> column(::std::size_t index) const;
+
+private:
+	_fm_mapped_file file_;
+	::std::vector<::std::span<const fixed<policy>>> columns_;
+};
+
+} // namespace fixmath
+
+#include "fixed_column_file.inl"
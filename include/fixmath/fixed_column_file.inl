@@ -0,0 +1,128 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+static_assert(sizeof(column_file_header) == 32, "column file header must not contain padding");
+static_assert(sizeof(column_file_entry) == 16, "column file entry must not contain padding");
+
+template <FixedPolicy policy>
+constexpr column_file_header _fm_column_file_header(uint32_t column_count) {
+	column_file_header header = {};
+	for (int i = 0; i < 8; ++i) {
+		header.magic[i] = COLUMN_FILE_MAGIC[i];
+	}
+	header.version = COLUMN_FILE_VERSION;
+	header.byte_order = COLUMN_FILE_BYTE_ORDER;
+	header.raw_bytes = static_cast<uint8_t>(sizeof(typename policy::raw_t));
+	header.fraction_bits = static_cast<uint8_t>(policy::fraction_bits);
+	header.arithmetic_mode = static_cast<uint8_t>(policy::strict_mode       ? arithmetic_mode::StrictMode
+	                                              : policy::saturation_mode ? arithmetic_mode::SaturationMode
+	                                                                        : arithmetic_mode::Ignore);
+	header.rounding_mode = static_cast<uint8_t>(policy::rounding ? rounding_mode::RoundToEven : rounding_mode::RoundToZero);
+	header.column_count = column_count;
+	header.directory_offset = sizeof(column_file_header);
+	return header;
+}
+
+constexpr uint64_t _fm_column_file_align(uint64_t offset) {
+	return (offset + COLUMN_FILE_ALIGNMENT - 1) & ~(COLUMN_FILE_ALIGNMENT - 1);
+}
+
+template <FixedPolicy policy>
+::std::errc write_column_file(const char* path, ::std::span<const ::std::span<const fixed<policy>>> columns) {
+	static_assert(sizeof(fixed<policy>) == sizeof(typename policy::raw_t) && ::std::is_trivially_copyable_v<fixed<policy>>);
+
+	const column_file_header header = _fm_column_file_header<policy>(static_cast<uint32_t>(columns.size()));
+	::std::vector<column_file_entry> directory(columns.size());
+	uint64_t offset = _fm_column_file_align(header.directory_offset + columns.size() * sizeof(column_file_entry));
+	for (::std::size_t i = 0; i < columns.size(); ++i) {
+		directory[i] = {offset, columns[i].size()};
+		offset = _fm_column_file_align(offset + columns[i].size_bytes());
+	}
+
+	::std::FILE* file = ::std::fopen(path, "wb");
+	if (file == nullptr) {
+		return static_cast<::std::errc>(errno);
+	}
+	const char padding[COLUMN_FILE_ALIGNMENT] = {};
+	uint64_t written = 0;
+	const auto write = [&](const void* data, ::std::size_t size) {
+		written += size;
+		return ::std::fwrite(data, 1, size, file) == size;
+	};
+	const auto pad = [&] { return write(padding, static_cast<::std::size_t>(_fm_column_file_align(written) - written)); };
+
+	bool ok = write(&header, sizeof(header)) && write(directory.data(), directory.size() * sizeof(column_file_entry)) && pad();
+	for (::std::size_t i = 0; ok && i < columns.size(); ++i) {
+		ok = write(columns[i].data(), columns[i].size_bytes()) && pad();
+	}
+	const int error = ok ? 0 : errno;
+	if (::std::fclose(file) != 0 && ok) {
+		return static_cast<::std::errc>(errno);
+	}
+	return ok ? ::std::errc{} : static_cast<::std::errc>(error != 0 ? error : EIO);
+}
+
+template <FixedPolicy policy>
+::std::errc column_file<policy>::open(const char* path) {
+	static_assert(sizeof(fixed<policy>) == sizeof(typename policy::raw_t) && ::std::is_trivially_copyable_v<fixed<policy>>);
+
+	close();
+	if (const ::std::errc error = file_.open(path); error != ::std::errc{}) {
+		return error;
+	}
+	const auto fail = [this](::std::errc error) {
+		close();
+		return error;
+	};
+
+	const uint64_t size = file_.size();
+	column_file_header header;
+	if (size < sizeof(header)) {
+		return fail(::std::errc::illegal_byte_sequence);
+	}
+	::std::memcpy(&header, file_.data(), sizeof(header));
+	if (::std::memcmp(header.magic, COLUMN_FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != COLUMN_FILE_VERSION || header.byte_order != COLUMN_FILE_BYTE_ORDER) {
+		return fail(::std::errc::illegal_byte_sequence);
+	}
+	const column_file_header expected = _fm_column_file_header<policy>(header.column_count);
+	if (header.raw_bytes != expected.raw_bytes || header.fraction_bits != expected.fraction_bits || header.arithmetic_mode != expected.arithmetic_mode || header.rounding_mode != expected.rounding_mode) {
+		return fail(::std::errc::invalid_argument);
+	}
+	if (header.directory_offset > size || (size - header.directory_offset) / sizeof(column_file_entry) < header.column_count) {
+		return fail(::std::errc::illegal_byte_sequence);
+	}
+
+	columns_.resize(header.column_count);
+	for (uint32_t i = 0; i < header.column_count; ++i) {
+		column_file_entry entry;
+		::std::memcpy(&entry, file_.data() + header.directory_offset + i * sizeof(entry), sizeof(entry));
+		if (entry.offset % COLUMN_FILE_ALIGNMENT != 0 || entry.offset > size || (size - entry.offset) / sizeof(fixed<policy>) < entry.count) {
+			return fail(::std::errc::illegal_byte_sequence);
+		}
+		// The mapping is page aligned and the offset is a multiple of 64, so the payload is
+		// suitably aligned for raw_t; fixed<policy> has the same size and is trivially copyable.
+		const auto* first = reinterpret_cast<const fixed<policy>*>(file_.data() + entry.offset);
+		columns_[i] = {first, static_cast<::std::size_t>(entry.count)};
+	}
+	return ::std::errc{};
+}
+
+template <FixedPolicy policy>
+void column_file<policy>::close() {
+	columns_.clear();
+	file_.close();
+}
+
+template <FixedPolicy policy>
+::std::span<const fixed<policy>> column_file<policy>::column(::std::size_t index) const {
+	FIXMATH_ASSERT(index < columns_.size(), "column index out of range");
+	return columns_[index];
+}
+
+} // namespace fixmath
@@ -0,0 +1,97 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <span> // for std::span
+#include "fixed.hpp"
+#include "fixed_parallel.hpp"
+
+namespace fixmath {
+
+template <class T>
+struct complex;
+
+// Complex number with fixed-point parts, stored as re then im, so a span of them is the
+// interleaved layout re0, im0, re1, im1, ... Products sum their full-width partial products
+// exactly and round once, instead of rounding and saturating each of the four operator*
+// calls. Strict mode is not supported: a nan or inf part has no complex meaning here.
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+struct complex<fixed<policy>> {
+	using value_type = fixed<policy>;
+
+	value_type re = {};
+	value_type im = {};
+
+	constexpr complex() = default;
+	constexpr complex(value_type real, value_type imag = {}) : re(real), im(imag) {}
+
+	constexpr value_type real() const { return re; }
+	constexpr value_type imag() const { return im; }
+
+	constexpr complex& operator+=(complex other);
+	constexpr complex& operator-=(complex other);
+	constexpr complex& operator*=(complex other);
+
+	friend constexpr bool operator==(complex, complex) = default;
+};
+
+// Parts are added and subtracted with operator+ and operator-.
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator+(complex<fixed<policy>> a, complex<fixed<policy>> b);
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator-(complex<fixed<policy>> a, complex<fixed<policy>> b);
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator-(complex<fixed<policy>> a);
+
+// (a.re * b.re - a.im * b.im) + i (a.re * b.im + a.im * b.re), each part rounded once from the
+// exact sum and saturated, or wrapped in Ignore mode, like operator*.
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(complex<fixed<policy>> a, complex<fixed<policy>> b);
+
+// Scaling by a real value: one operator* per part.
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(complex<fixed<policy>> a, fixed<policy> b);
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(fixed<policy> a, complex<fixed<policy>> b);
+
+// c + a * b with the addend joined to the exact product sums, so each part rounds once.
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> fma(complex<fixed<policy>> a, complex<fixed<policy>> b, complex<fixed<policy>> c);
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> conj(complex<fixed<policy>> a);
+
+// a.re^2 + a.im^2, rounded once.
+template <FixedPolicy policy>
+constexpr fixed<policy> norm(complex<fixed<policy>> a);
+
+namespace parallel {
+
+// out[i] = a[i] * b[i] over interleaved complex spans, with exactly the values of the fused
+// operator*. All three spans must have the same length, and out may be the same span as a or b.
+template <FixedPolicy policy>
+void complex_multiply(::std::span<const complex<fixed<policy>>> a, ::std::span<const complex<fixed<policy>>> b, ::std::span<complex<fixed<policy>>> out, const options& opts = {});
+
+// acc[i] = fma(a[i], b[i], acc[i]) over interleaved complex spans.
+template <FixedPolicy policy>
+void complex_multiply_add(::std::span<const complex<fixed<policy>>> a, ::std::span<const complex<fixed<policy>>> b, ::std::span<complex<fixed<policy>>> acc, const options& opts = {});
+
+// The same over the split layout, where the real and imaginary parts are separate arrays, as
+// fft uses them. Every span must have the same length.
+template <FixedPolicy policy>
+void complex_multiply(::std::span<const fixed<policy>> a_real, ::std::span<const fixed<policy>> a_imag, ::std::span<const fixed<policy>> b_real, ::std::span<const fixed<policy>> b_imag, ::std::span<fixed<policy>> out_real, ::std::span<fixed<policy>> out_imag, const options& opts = {});
+
+template <FixedPolicy policy>
+void complex_multiply_add(::std::span<const fixed<policy>> a_real, ::std::span<const fixed<policy>> a_imag, ::std::span<const fixed<policy>> b_real, ::std::span<const fixed<policy>> b_imag, ::std::span<fixed<policy>> acc_real, ::std::span<fixed<policy>> acc_imag, const options& opts = {});
+
+} // namespace parallel
+
+} // namespace fixmath
+
+#include "fixed_complex.inl"
@@ -0,0 +1,296 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Exact real and imaginary parts of a * b, in units of 2^-2F. The four-multiply form is used
+// throughout: the sums are exact, so the three-multiply form would round to the same parts,
+// but its factor sums need one more bit than a raw and its two extra additions cost more than
+// the multiply they save.
+template <FixedPolicy policy>
+constexpr void _fm_complex_mul_wide(complex<fixed<policy>> a, complex<fixed<policy>> b, _fm_int192& re, _fm_int192& im) {
+	_fm_int192 im_im = _fm_product192<policy>(a.im.raw(), b.im.raw());
+	_fm_neg(im_im);
+	re = _fm_product192<policy>(a.re.raw(), b.re.raw());
+	_fm_add(re, im_im);
+	im = _fm_product192<policy>(a.re.raw(), b.im.raw());
+	_fm_add(im, _fm_product192<policy>(a.im.raw(), b.re.raw()));
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr complex<fixed<policy>>& complex<fixed<policy>>::operator+=(complex other) {
+	return *this = *this + other;
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr complex<fixed<policy>>& complex<fixed<policy>>::operator-=(complex other) {
+	return *this = *this - other;
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr complex<fixed<policy>>& complex<fixed<policy>>::operator*=(complex other) {
+	return *this = *this * other;
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator+(complex<fixed<policy>> a, complex<fixed<policy>> b) {
+	return {a.re + b.re, a.im + b.im};
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator-(complex<fixed<policy>> a, complex<fixed<policy>> b) {
+	return {a.re - b.re, a.im - b.im};
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator-(complex<fixed<policy>> a) {
+	return {-a.re, -a.im};
+}
+
+// c * 2^F + a * b, each part rounded once from the exact sum.
+template <FixedPolicy policy, bool accumulate>
+constexpr complex<fixed<policy>> _fm_complex_fma(complex<fixed<policy>> a, complex<fixed<policy>> b, complex<fixed<policy>> c) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+		// The real part and c * 2^F always fit int64_t; only sums of 32-bit raws near min_fix
+		// can leave it, and those take the wide path below.
+		bool overflow[3] = {};
+		int64_t re = int64_t{a.re.raw()} * b.re.raw() - int64_t{a.im.raw()} * b.im.raw();
+		int64_t im = _fm_checked_add(int64_t{a.re.raw()} * b.im.raw(), int64_t{a.im.raw()} * b.re.raw(), overflow[0]);
+		if constexpr (accumulate) {
+			re = _fm_checked_add(re, int64_t{c.re.raw()} * (int64_t{1} << F), overflow[1]);
+			im = _fm_checked_add(im, int64_t{c.im.raw()} * (int64_t{1} << F), overflow[2]);
+		}
+		if (FIXMATH_LIKELY(!(overflow[0] | overflow[1] | overflow[2]))) {
+			return {_fm_round_sum<policy>(re), _fm_round_sum<policy>(im)};
+		}
+	}
+	_fm_int192 re = {};
+	_fm_int192 im = {};
+	_fm_complex_mul_wide(a, b, re, im);
+	if constexpr (accumulate) {
+		// c * 2^F fits 128 bits for every raw width
+		const int64_t c_re = c.re.raw();
+		const int64_t c_im = c.im.raw();
+		_fm_add(re, c_re >> (63 - F) >> 1, static_cast<uint64_t>(c_re) << F);
+		_fm_add(im, c_im >> (63 - F) >> 1, static_cast<uint64_t>(c_im) << F);
+	}
+	return {_fm_round_sum<policy>(re), _fm_round_sum<policy>(im)};
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(complex<fixed<policy>> a, complex<fixed<policy>> b) {
+	return _fm_complex_fma<policy, false>(a, b, {});
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(complex<fixed<policy>> a, fixed<policy> b) {
+	return {a.re * b, a.im * b};
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> operator*(fixed<policy> a, complex<fixed<policy>> b) {
+	return {a * b.re, a * b.im};
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> fma(complex<fixed<policy>> a, complex<fixed<policy>> b, complex<fixed<policy>> c) {
+	return _fm_complex_fma<policy, true>(a, b, c);
+}
+
+template <FixedPolicy policy>
+constexpr complex<fixed<policy>> conj(complex<fixed<policy>> a) {
+	return {a.re, -a.im};
+}
+
+template <FixedPolicy policy>
+constexpr fixed<policy> norm(complex<fixed<policy>> a) {
+	if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+		// two squares of at most 2^62 each
+		const uint64_t sum = static_cast<uint64_t>(int64_t{a.re.raw()} * a.re.raw()) + static_cast<uint64_t>(int64_t{a.im.raw()} * a.im.raw());
+		if (FIXMATH_LIKELY(sum <= static_cast<uint64_t>(::std::numeric_limits<int64_t>::max()))) {
+			return _fm_round_sum<policy>(static_cast<int64_t>(sum));
+		}
+	}
+	_fm_int192 sum = _fm_product192<policy>(a.re.raw(), a.re.raw());
+	_fm_add(sum, _fm_product192<policy>(a.im.raw(), a.im.raw()));
+	return _fm_round_sum<policy>(sum);
+}
+
+template <FixedPolicy policy, bool accumulate>
+inline void _fm_complex_multiply_block(const complex<fixed<policy>>* a, const complex<fixed<policy>>* b, complex<fixed<policy>>* out, ::std::size_t count) {
+	for (::std::size_t i = 0; i < count; ++i) {
+		out[i] = accumulate ? fma(a[i], b[i], out[i]) : a[i] * b[i];
+	}
+}
+
+template <FixedPolicy policy, bool accumulate>
+inline void _fm_complex_multiply_split_block(const fixed<policy>* a_real, const fixed<policy>* a_imag, const fixed<policy>* b_real, const fixed<policy>* b_imag, fixed<policy>* out_real, fixed<policy>* out_imag, ::std::size_t count) {
+	for (::std::size_t i = 0; i < count; ++i) {
+		const complex<fixed<policy>> a{a_real[i], a_imag[i]};
+		const complex<fixed<policy>> b{b_real[i], b_imag[i]};
+		const complex<fixed<policy>> r = accumulate ? fma(a, b, complex<fixed<policy>>{out_real[i], out_imag[i]}) : a * b;
+		out_real[i] = r.re;
+		out_imag[i] = r.im;
+	}
+}
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+// The even 32-bit elements of c, sign-extended to 64 bits and multiplied by 2^F.
+template <int F>
+FIXMATH_TARGET("avx2") inline __m256i _fm_scale_epi32_avx2(__m256i c) {
+	if constexpr (F < 31) {
+		return _mm256_mul_epi32(c, _mm256_set1_epi32(int32_t{1} << F));
+	} else {
+		return _mm256_slli_epi64(_mm256_mul_epi32(c, _mm256_set1_epi32(int32_t{1} << 30)), 1);
+	}
+}
+
+// Exact parts of four complex products of 32-bit raws, from the even 32-bit elements of the
+// operands. vpmuldq gives each 62-bit partial product. The real part cannot leave int64_t;
+// the imaginary part only for (-1.0)^2 + (-1.0)^2 in Q0.31 terms, and an accumulated addend
+// may push either part out, so such lanes are flagged for operator/fma instead.
+template <FixedPolicy policy, bool accumulate>
+FIXMATH_TARGET("avx2") inline void _fm_complex_mul_epi64_avx2(__m256i a_re, __m256i a_im, __m256i b_re, __m256i b_im, __m256i c_re, __m256i c_im, __m256i& re, __m256i& im, __m256i& overflow) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	re = _mm256_sub_epi64(_mm256_mul_epi32(a_re, b_re), _mm256_mul_epi32(a_im, b_im));
+	im = _fm_add_epi64_avx2(_mm256_mul_epi32(a_re, b_im), _mm256_mul_epi32(a_im, b_re), overflow);
+	if constexpr (accumulate) {
+		re = _fm_add_epi64_avx2(re, _fm_scale_epi32_avx2<F>(c_re), overflow);
+		im = _fm_add_epi64_avx2(im, _fm_scale_epi32_avx2<F>(c_im), overflow);
+	}
+}
+
+// Interleaved layout: one vector holds four complex values, re in the even and im in the odd
+// elements, which is exactly the pairing vpmuldq and _fm_round64_avx2 work with.
+// Requires _fm_cpu().avx2.
+template <FixedPolicy policy, bool accumulate>
+FIXMATH_TARGET("avx2") void _fm_complex_multiply_block_avx2(const complex<fixed<policy>>* a, const complex<fixed<policy>>* b, complex<fixed<policy>>* out, ::std::size_t count) {
+	static_assert(sizeof(complex<fixed<policy>>) == 2 * sizeof(int32_t));
+	::std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+		const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+		__m256i c = _mm256_setzero_si256();
+		if constexpr (accumulate) {
+			c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(out + i));
+		}
+		__m256i re;
+		__m256i im;
+		__m256i overflow = _mm256_setzero_si256();
+		_fm_complex_mul_epi64_avx2<policy, accumulate>(x, _mm256_srli_epi64(x, 32), y, _mm256_srli_epi64(y, 32), c, _mm256_srli_epi64(c, 32), re, im, overflow);
+		if (FIXMATH_UNLIKELY(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0)) {
+			_fm_complex_multiply_block<policy, accumulate>(a + i, b + i, out + i, 4);
+			continue;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _fm_round64_pair_avx2<policy>(re, im));
+	}
+	_fm_complex_multiply_block<policy, accumulate>(a + i, b + i, out + i, count - i);
+}
+
+// Split layout: eight complex values per step, as two halves of the even and the odd elements.
+// Requires _fm_cpu().avx2.
+template <FixedPolicy policy, bool accumulate>
+FIXMATH_TARGET("avx2") void _fm_complex_multiply_split_block_avx2(const fixed<policy>* a_real, const fixed<policy>* a_imag, const fixed<policy>* b_real, const fixed<policy>* b_imag, fixed<policy>* out_real, fixed<policy>* out_imag, ::std::size_t count) {
+	::std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i x_re = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_real + i));
+		const __m256i x_im = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_imag + i));
+		const __m256i y_re = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b_real + i));
+		const __m256i y_im = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b_imag + i));
+		__m256i c_re = _mm256_setzero_si256();
+		__m256i c_im = _mm256_setzero_si256();
+		if constexpr (accumulate) {
+			c_re = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(out_real + i));
+			c_im = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(out_imag + i));
+		}
+		__m256i even_re;
+		__m256i even_im;
+		__m256i odd_re;
+		__m256i odd_im;
+		__m256i overflow = _mm256_setzero_si256();
+		_fm_complex_mul_epi64_avx2<policy, accumulate>(x_re, x_im, y_re, y_im, c_re, c_im, even_re, even_im, overflow);
+		_fm_complex_mul_epi64_avx2<policy, accumulate>(_mm256_srli_epi64(x_re, 32), _mm256_srli_epi64(x_im, 32), _mm256_srli_epi64(y_re, 32), _mm256_srli_epi64(y_im, 32), _mm256_srli_epi64(c_re, 32), _mm256_srli_epi64(c_im, 32), odd_re, odd_im, overflow);
+		if (FIXMATH_UNLIKELY(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0)) {
+			_fm_complex_multiply_split_block<policy, accumulate>(a_real + i, a_imag + i, b_real + i, b_imag + i, out_real + i, out_imag + i, 8);
+			continue;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out_real + i), _fm_round64_pair_avx2<policy>(even_re, odd_re));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out_imag + i), _fm_round64_pair_avx2<policy>(even_im, odd_im));
+	}
+	_fm_complex_multiply_split_block<policy, accumulate>(a_real + i, a_imag + i, b_real + i, b_imag + i, out_real + i, out_imag + i, count - i);
+}
+#endif
+
+template <FixedPolicy policy, bool accumulate>
+void _fm_complex_multiply(::std::span<const complex<fixed<policy>>> a, ::std::span<const complex<fixed<policy>>> b, ::std::span<complex<fixed<policy>>> out, const parallel::options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size() && a.size() == out.size(), "complex operands and output must have the same length");
+	const ::std::size_t count = ::std::min({a.size(), b.size(), out.size()});
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int32_t)) {
+			if (_fm_cpu().avx2) {
+				_fm_complex_multiply_block_avx2<policy, accumulate>(a.data() + first, b.data() + first, out.data() + first, last - first);
+				return;
+			}
+		}
+#endif
+		_fm_complex_multiply_block<policy, accumulate>(a.data() + first, b.data() + first, out.data() + first, last - first);
+	});
+}
+
+template <FixedPolicy policy, bool accumulate>
+void _fm_complex_multiply_split(::std::span<const fixed<policy>> a_real, ::std::span<const fixed<policy>> a_imag, ::std::span<const fixed<policy>> b_real, ::std::span<const fixed<policy>> b_imag, ::std::span<fixed<policy>> out_real, ::std::span<fixed<policy>> out_imag, const parallel::options& opts) {
+	const ::std::size_t count = ::std::min({a_real.size(), a_imag.size(), b_real.size(), b_imag.size(), out_real.size(), out_imag.size()});
+	FIXMATH_ASSERT(count == a_real.size() && count == a_imag.size() && count == b_real.size() && count == b_imag.size() && count == out_real.size() && count == out_imag.size(), "complex operands and output must have the same length");
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int32_t)) {
+			if (_fm_cpu().avx2) {
+				_fm_complex_multiply_split_block_avx2<policy, accumulate>(a_real.data() + first, a_imag.data() + first, b_real.data() + first, b_imag.data() + first, out_real.data() + first, out_imag.data() + first, last - first);
+				return;
+			}
+		}
+#endif
+		_fm_complex_multiply_split_block<policy, accumulate>(a_real.data() + first, a_imag.data() + first, b_real.data() + first, b_imag.data() + first, out_real.data() + first, out_imag.data() + first, last - first);
+	});
+}
+
+namespace parallel {
+
+template <FixedPolicy policy>
+void complex_multiply(::std::span<const complex<fixed<policy>>> a, ::std::span<const complex<fixed<policy>>> b, ::std::span<complex<fixed<policy>>> out, const options& opts) {
+	_fm_complex_multiply<policy, false>(a, b, out, opts);
+}
+
+template <FixedPolicy policy>
+void complex_multiply_add(::std::span<const complex<fixed<policy>>> a, ::std::span<const complex<fixed<policy>>> b, ::std::span<complex<fixed<policy>>> acc, const options& opts) {
+	_fm_complex_multiply<policy, true>(a, b, acc, opts);
+}
+
+template <FixedPolicy policy>
+void complex_multiply(::std::span<const fixed<policy>> a_real, ::std::span<const fixed<policy>> a_imag, ::std::span<const fixed<policy>> b_real, ::std::span<const fixed<policy>> b_imag, ::std::span<fixed<policy>> out_real, ::std::span<fixed<policy>> out_imag, const options& opts) {
+	_fm_complex_multiply_split<policy, false>(a_real, a_imag, b_real, b_imag, out_real, out_imag, opts);
+}
+
+template <FixedPolicy policy>
+void complex_multiply_add(::std::span<const fixed<policy>> a_real, ::std::span<const fixed<policy>> a_imag, ::std::span<const fixed<policy>> b_real, ::std::span<const fixed<policy>> b_imag, ::std::span<fixed<policy>> acc_real, ::std::span<fixed<policy>> acc_imag, const options& opts) {
+	_fm_complex_multiply_split<policy, true>(a_real, a_imag, b_real, b_imag, acc_real, acc_imag, opts);
+}
+
+} // namespace parallel
+
+} // namespace fixmath
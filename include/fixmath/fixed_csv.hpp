@@ -0,0 +1,57 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <cstring>      // for std::memchr
+#include <span>         // for std::span
+#include <string_view>  // for std::string_view
+#include <system_error> // for std::errc
+#include <vector>       // for std::vector
+#include "fixed.hpp"
+#include "fixmath_thread.inl"
+#include "fixmath_mmap.inl"
+
+namespace fixmath {
+
+struct csv_options {
+	char delimiter = ',';
+	// Skip the first line as a column header.
+	bool header = true;
+	// 0 selects std::thread::hardware_concurrency().
+	unsigned thread_count = 0;
+	// Target chunk size; every chunk is extended to the next line boundary.
+	::std::size_t chunk_bytes = ::std::size_t{1} << 22;
+};
+
+struct csv_error {
+	// Zero-based data row, not counting the header line.
+	::std::size_t row;
+	// Zero-based field index within the line.
+	::std::size_t field;
+};
+
+template <FixedPolicy policy>
+struct csv_columns {
+	using raw_t = typename fixed<policy>::raw_t;
+
+	// One raw column per requested field, in request order. A field that fails to parse stores 0.
+	::std::vector<::std::vector<raw_t>> columns;
+	// Rejected or missing fields, ordered by row.
+	::std::vector<csv_error> errors;
+	::std::size_t rows = 0;
+};
+
+// Parse the requested fields of every line with the decimal from_string grammar.
+template <FixedPolicy policy>
+void parse_csv_columns(::std::string_view text, ::std::span<const ::std::size_t> fields, csv_columns<policy>& out, const csv_options& options = {});
+
+// Map the file read-only and parse it with parse_csv_columns. Returns a non-zero code only
+// when the file cannot be opened or mapped; per-row problems are reported in out.errors.
+template <FixedPolicy policy>
+::std::errc read_csv_columns(const char* path, ::std::span<const ::std::size_t> fields, csv_columns<policy>& out, const csv_options& options = {});
+
+} // namespace fixmath
+
+#include "fixed_csv.inl"
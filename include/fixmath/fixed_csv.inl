@@ -0,0 +1,137 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Line boundaries of [first, last). A trailing line without a newline still counts.
+inline ::std::size_t _fm_csv_count_lines(const char* first, const char* last) {
+	::std::size_t count = 0;
+	while (first != last) {
+		const void* newline = ::std::memchr(first, '\n', static_cast<::std::size_t>(last - first));
+		if (newline == nullptr) {
+			return count + 1;
+		}
+		first = static_cast<const char*>(newline) + 1;
+		++count;
+	}
+	return count;
+}
+
+template <FixedPolicy policy>
+void parse_csv_columns(::std::string_view text, ::std::span<const ::std::size_t> fields, csv_columns<policy>& out, const csv_options& options) {
+	using raw_t = typename fixed<policy>::raw_t;
+
+	if (text.empty()) {
+		// data() may be null, which memchr does not accept even for a zero length.
+		out.rows = 0;
+		out.columns.assign(fields.size(), {});
+		out.errors.clear();
+		return;
+	}
+
+	const char* const begin = text.data();
+	const char* const end = begin + text.size();
+	const char* body = begin;
+	if (options.header) {
+		const void* newline = ::std::memchr(begin, '\n', text.size());
+		body = newline == nullptr ? end : static_cast<const char*>(newline) + 1;
+	}
+
+	// Split at line boundaries so that every chunk can be scanned independently.
+	::std::vector<const char*> bounds{body};
+	const ::std::size_t chunk_bytes = options.chunk_bytes == 0 ? 1 : options.chunk_bytes;
+	for (const char* cut = body; cut != end;) {
+		if (static_cast<::std::size_t>(end - cut) <= chunk_bytes) {
+			cut = end;
+		} else {
+			const void* newline = ::std::memchr(cut + chunk_bytes, '\n', static_cast<::std::size_t>(end - cut - chunk_bytes));
+			cut = newline == nullptr ? end : static_cast<const char*>(newline) + 1;
+		}
+		bounds.push_back(cut);
+	}
+	const ::std::size_t chunk_count = bounds.size() - 1;
+
+	// Pass 1: rows per chunk, then prefix sums give each chunk its first global row.
+	::std::vector<::std::size_t> first_row(chunk_count + 1, 0);
+	_fm_parallel_for(chunk_count, options.thread_count, [&](::std::size_t chunk) {
+		first_row[chunk + 1] = _fm_csv_count_lines(bounds[chunk], bounds[chunk + 1]);
+	});
+	for (::std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+		first_row[chunk + 1] += first_row[chunk];
+	}
+
+	out.rows = first_row[chunk_count];
+	out.columns.assign(fields.size(), ::std::vector<raw_t>(out.rows));
+	out.errors.clear();
+
+	// Pass 2: every chunk writes its own rows in place and collects its own errors.
+	::std::vector<::std::vector<csv_error>> chunk_errors(chunk_count);
+	_fm_parallel_for(chunk_count, options.thread_count, [&](::std::size_t chunk) {
+		::std::vector<csv_error>& errors = chunk_errors[chunk];
+		::std::size_t row = first_row[chunk];
+		const char* line = bounds[chunk];
+		const char* const chunk_end = bounds[chunk + 1];
+		while (line != chunk_end) {
+			const void* newline = ::std::memchr(line, '\n', static_cast<::std::size_t>(chunk_end - line));
+			const char* const next = newline == nullptr ? chunk_end : static_cast<const char*>(newline) + 1;
+			const char* line_end = newline == nullptr ? chunk_end : static_cast<const char*>(newline);
+			if (line_end != line && line_end[-1] == '\r') {
+				--line_end;
+			}
+
+			::std::size_t found = 0;
+			::std::size_t field = 0;
+			const char* cell = line;
+			for (;;) {
+				const void* delimiter = ::std::memchr(cell, options.delimiter, static_cast<::std::size_t>(line_end - cell));
+				const char* const cell_end = delimiter == nullptr ? line_end : static_cast<const char*>(delimiter);
+				for (::std::size_t slot = 0; slot < fields.size(); ++slot) {
+					if (fields[slot] != field) {
+						continue;
+					}
+					++found;
+					raw_t& value = out.columns[slot][row];
+					if (!_fm_parse_decimal<policy>(cell, cell_end, value)) {
+						value = raw_t{0};
+						errors.push_back({row, field});
+					}
+				}
+				if (delimiter == nullptr || found == fields.size()) {
+					break;
+				}
+				cell = cell_end + 1;
+				++field;
+			}
+			if (found != fields.size()) {
+				for (::std::size_t slot = 0; slot < fields.size(); ++slot) {
+					if (fields[slot] > field) {
+						errors.push_back({row, fields[slot]});
+					}
+				}
+			}
+
+			line = next;
+			++row;
+		}
+	});
+
+	for (::std::vector<csv_error>& errors : chunk_errors) {
+		out.errors.insert(out.errors.end(), errors.begin(), errors.end());
+	}
+}
+
+template <FixedPolicy policy>
+::std::errc read_csv_columns(const char* path, ::std::span<const ::std::size_t> fields, csv_columns<policy>& out, const csv_options& options) {
+	_fm_mapped_file file;
+	if (const ::std::errc error = file.open(path); error != ::std::errc{}) {
+		return error;
+	}
+	parse_csv_columns<policy>(::std::string_view(file.data(), file.size()), fields, out, options);
+	return ::std::errc{};
+}
+
+} // namespace fixmath
@@ -0,0 +1,45 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <algorithm> // for std::max, std::min, std::swap
+#include <bit>       // for std::bit_width, std::has_single_bit
+#include <span>      // for std::span
+#include "fixed.hpp"
+
+namespace fixmath {
+
+enum class fft_radix {
+	// log2(N) radix-2 stages.
+	Radix2,
+	// Radix-4 stages, plus one radix-2 stage first when log2(N) is odd.
+	Radix4,
+};
+
+// Sizes with compile-time twiddle tables: powers of two from 4 to 2^16.
+template <::std::size_t N>
+concept FftSize = N >= 4 && N <= (::std::size_t{1} << 16) && ::std::has_single_bit(N);
+
+template <FixedPolicy policy>
+constexpr bool _fm_fft_policy = !policy::strict_mode && (sizeof(typename policy::raw_t) == sizeof(int32_t) || sizeof(typename policy::raw_t) == sizeof(int64_t));
+
+// In-place forward DFT X[k] = sum(x[n] * e^(-2 pi i n k / N)) of the complex sequence
+// real[n] + i * imag[n], in natural order. Stages are scaled by powers of two only when the
+// data could overflow, so the return value e is the block exponent: the exact transform is
+// (real[k] + i * imag[k]) * 2^e. Only the raws matter, so any number of fraction bits works.
+// Requires 32- or 64-bit raws; strict mode is not supported.
+template <fft_radix radix = fft_radix::Radix4, FixedPolicy policy, ::std::size_t N>
+	requires(FftSize<N> && _fm_fft_policy<policy>)
+int fft(::std::span<fixed<policy>, N> real, ::std::span<fixed<policy>, N> imag);
+
+// In-place inverse DFT x[n] = sum(X[k] * e^(2 pi i n k / N)) / N with the same block exponent
+// convention, so ifft(fft(x)) returns x scaled by 2^(e1 + e2) up to rounding.
+template <fft_radix radix = fft_radix::Radix4, FixedPolicy policy, ::std::size_t N>
+	requires(FftSize<N> && _fm_fft_policy<policy>)
+int ifft(::std::span<fixed<policy>, N> real, ::std::span<fixed<policy>, N> imag);
+
+} // namespace fixmath
+
+#include "fixed_fft.inl"
@@ -0,0 +1,339 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Twiddles are stored in the raw type of the data: Q1.31 for 32-bit raws, where 1.0 saturates
+// to 1 - 2^-31, and Q32.32 for 64-bit raws.
+template <class raw_t>
+constexpr int _fm_fft_twiddle_bits = sizeof(raw_t) == sizeof(int32_t) ? 31 : 32;
+
+// Butterfly spans m of the stages, in order. Radix-2 stages combine pairs m apart and
+// radix-4 stages combine quadruples m apart.
+template <::std::size_t N, fft_radix radix>
+constexpr ::std::size_t _fm_fft_first_radix4_span() {
+	return radix == fft_radix::Radix4 && ::std::bit_width(N) % 2 == 0 ? 2 : 1;
+}
+
+// Stage tables stored one after another. A radix-2 stage of span m holds W^j for j < m, and a
+// radix-4 stage holds W^j, W^2j, and W^3j as three runs of m, where W = e^(-2 pi i / (4m))
+// for radix 4 and e^(-2 pi i / (2m)) for radix 2. Each inner loop therefore reads its twiddles
+// with unit stride, like its data.
+template <::std::size_t N, fft_radix radix>
+constexpr ::std::size_t _fm_fft_twiddle_count() {
+	if constexpr (radix == fft_radix::Radix2) {
+		return N - 1;
+	} else {
+		::std::size_t count = 0;
+		for (::std::size_t m = _fm_fft_first_radix4_span<N, radix>(); m < N; m *= 4) {
+			count += 3 * m;
+		}
+		return count;
+	}
+}
+
+template <class raw_t, ::std::size_t N, fft_radix radix>
+struct _fm_fft_twiddles {
+	// cos and sin of the positive angle; the forward transform conjugates.
+	raw_t cos[_fm_fft_twiddle_count<N, radix>()] = {};
+	raw_t sin[_fm_fft_twiddle_count<N, radix>()] = {};
+};
+
+// Builds the stage tables from the Q32.32 sine and cosine kernel. The kernel is evaluated on the
+// first octant only, and the rest of the circle follows from exact symmetries, so for example
+// cos(2 pi k / N) == -cos(2 pi (N / 2 - k) / N) holds bit for bit.
+template <class raw_t, ::std::size_t N, fft_radix radix>
+constexpr _fm_fft_twiddles<raw_t, N, radix> _fm_make_fft_twiddles() {
+	using kernel_policy = fixed_policy<int64_t, 32, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+	// pi / 4 in Q0.64, as used by _fm_rem_pio4.
+	constexpr uint64_t PIO4 = 0xc90f'daa2'2168'c235ULL;
+	constexpr ::std::size_t QUARTER = N / 4;
+	constexpr int LOG2_EIGHTH = static_cast<int>(::std::bit_width(N)) - 4;
+
+	// cos and sin of 2 pi j / N for j <= N / 4.
+	raw_t quarter_cos[QUARTER + 1] = {};
+	raw_t quarter_sin[QUARTER + 1] = {};
+	for (::std::size_t j = 0; j <= QUARTER / 2; ++j) {
+		// 2 pi j / N = (pi / 4) * j / (N / 8) in Q32.32, from 40 bits of pi / 4.
+		constexpr int SHIFT = 8 + LOG2_EIGHTH;
+		const int64_t angle = static_cast<int64_t>((j * (PIO4 >> 24) + (uint64_t{1} << (SHIFT - 1))) >> SHIFT);
+		int64_t c = _fm_sincos<precision::Precise, kernel_policy>(angle, true);
+		int64_t s = _fm_sincos<precision::Precise, kernel_policy>(angle, false);
+		if constexpr (_fm_fft_twiddle_bits<raw_t> == 31) {
+			c = ::std::min<int64_t>((c + 1) >> 1, ::std::numeric_limits<int32_t>::max());
+			s = ::std::min<int64_t>((s + 1) >> 1, ::std::numeric_limits<int32_t>::max());
+		}
+		quarter_cos[j] = static_cast<raw_t>(c);
+		quarter_sin[j] = static_cast<raw_t>(s);
+		if (QUARTER - j != j) {
+			quarter_cos[QUARTER - j] = static_cast<raw_t>(s);
+			quarter_sin[QUARTER - j] = static_cast<raw_t>(c);
+		}
+	}
+	const auto set = [&](_fm_fft_twiddles<raw_t, N, radix>& table, ::std::size_t index, ::std::size_t k) {
+		const ::std::size_t j = k % QUARTER;
+		switch (k / QUARTER) {
+		case 0:
+			table.cos[index] = quarter_cos[j];
+			table.sin[index] = quarter_sin[j];
+			break;
+		case 1:
+			table.cos[index] = -quarter_sin[j];
+			table.sin[index] = quarter_cos[j];
+			break;
+		case 2:
+			table.cos[index] = -quarter_cos[j];
+			table.sin[index] = -quarter_sin[j];
+			break;
+		default:
+			table.cos[index] = quarter_sin[j];
+			table.sin[index] = -quarter_cos[j];
+			break;
+		}
+	};
+
+	_fm_fft_twiddles<raw_t, N, radix> table;
+	::std::size_t offset = 0;
+	if constexpr (radix == fft_radix::Radix2) {
+		for (::std::size_t m = 1; m < N; m *= 2) {
+			for (::std::size_t j = 0; j < m; ++j) {
+				set(table, offset + j, j * (N / (2 * m)));
+			}
+			offset += m;
+		}
+	} else {
+		for (::std::size_t m = _fm_fft_first_radix4_span<N, radix>(); m < N; m *= 4) {
+			for (::std::size_t j = 0; j < m; ++j) {
+				const ::std::size_t k = j * (N / (4 * m));
+				set(table, offset + j, k);
+				set(table, offset + m + j, 2 * k);
+				set(table, offset + 2 * m + j, 3 * k);
+			}
+			offset += 3 * m;
+		}
+	}
+	return table;
+}
+
+template <class raw_t, ::std::size_t N, fft_radix radix>
+inline constexpr _fm_fft_twiddles<raw_t, N, radix> _fm_fft_twiddle_table = _fm_make_fft_twiddles<raw_t, N, radix>();
+
+// (a * wa + b * wb) / 2^twiddle_bits, with the policy's rounding. Block scaling keeps a and b
+// small enough that the result fits raw_t.
+template <FixedPolicy policy>
+inline typename policy::raw_t _fm_fft_mul2(typename policy::raw_t a, typename policy::raw_t wa, typename policy::raw_t b, typename policy::raw_t wb) {
+	using raw_t = typename policy::raw_t;
+	constexpr int TWIDDLE_BITS = _fm_fft_twiddle_bits<raw_t>;
+	if constexpr (sizeof(raw_t) == sizeof(int32_t)) {
+		return static_cast<raw_t>(_fm_div2n_round<policy, TWIDDLE_BITS>(int64_t{a} * wa + int64_t{b} * wb));
+	} else {
+		int64_t a_hi = 0;
+		const uint64_t a_lo = static_cast<uint64_t>(_fm_mul128(a, wa, a_hi));
+		int64_t b_hi = 0;
+		const uint64_t b_lo = static_cast<uint64_t>(_fm_mul128(b, wb, b_hi));
+		const uint64_t lo = a_lo + b_lo;
+		int64_t hi = a_hi + b_hi + (lo < b_lo);
+		return _fm_div2n_round<policy, TWIDDLE_BITS>(hi, static_cast<int64_t>(lo), hi);
+	}
+}
+
+// x * (c + i s), or x * (c - i s) for the forward transform.
+template <FixedPolicy policy, bool INVERSE>
+inline void _fm_fft_twiddle(typename policy::raw_t& re, typename policy::raw_t& im, typename policy::raw_t c, typename policy::raw_t s) {
+	if constexpr (!INVERSE) {
+		s = -s;
+	}
+	const auto product_re = _fm_fft_mul2<policy>(re, c, im, -s);
+	im = _fm_fft_mul2<policy>(re, s, im, c);
+	re = product_re;
+}
+
+// Tracks the magnitude of written values: the bit width of the result bounds every |x|.
+template <class raw_t>
+inline void _fm_fft_track(::std::make_unsigned_t<raw_t>& bits, raw_t x) {
+	bits |= static_cast<::std::make_unsigned_t<raw_t>>(x ^ (x >> (sizeof(raw_t) * CHAR_BIT - 1)));
+}
+
+template <FixedPolicy policy, bool SCALE>
+inline typename policy::raw_t _fm_fft_load(fixed<policy> x, int shift) {
+	if constexpr (SCALE) {
+		return _fm_div2n_round<policy>(x.raw(), static_cast<uint64_t>(shift));
+	} else {
+		return x.raw();
+	}
+}
+
+// Radix-2 butterfly on x[i0] and x[i0 + m]. TWIDDLE is false for j == 0, where W^0 == 1.
+template <FixedPolicy policy, bool INVERSE, bool SCALE, bool TWIDDLE>
+inline void _fm_fft_butterfly2(fixed<policy>* real, fixed<policy>* imag, ::std::size_t i0, ::std::size_t m, typename policy::raw_t c, typename policy::raw_t s, int shift, ::std::make_unsigned_t<typename policy::raw_t>& bits) {
+	using raw_t = typename policy::raw_t;
+	const ::std::size_t i1 = i0 + m;
+	const raw_t a_re = _fm_fft_load<policy, SCALE>(real[i0], shift);
+	const raw_t a_im = _fm_fft_load<policy, SCALE>(imag[i0], shift);
+	raw_t b_re = _fm_fft_load<policy, SCALE>(real[i1], shift);
+	raw_t b_im = _fm_fft_load<policy, SCALE>(imag[i1], shift);
+	if constexpr (TWIDDLE) {
+		_fm_fft_twiddle<policy, INVERSE>(b_re, b_im, c, s);
+	}
+	const raw_t y0_re = a_re + b_re;
+	const raw_t y0_im = a_im + b_im;
+	const raw_t y1_re = a_re - b_re;
+	const raw_t y1_im = a_im - b_im;
+	_fm_fft_track(bits, y0_re);
+	_fm_fft_track(bits, y0_im);
+	_fm_fft_track(bits, y1_re);
+	_fm_fft_track(bits, y1_im);
+	real[i0] = fixed<policy>::from_raw(y0_re);
+	imag[i0] = fixed<policy>::from_raw(y0_im);
+	real[i1] = fixed<policy>::from_raw(y1_re);
+	imag[i1] = fixed<policy>::from_raw(y1_im);
+}
+
+// Radix-4 butterfly on x[i0 + k m], which does the work of two radix-2 stages of spans m and
+// 2m with three twiddle multiplies instead of four. The input is in bit-reversed order, so
+// the quadruple holds the sub-transforms in the order 0, 2, 1, 3, and takes the twiddles W^2j,
+// W^j, and W^3j.
+template <FixedPolicy policy, bool INVERSE, bool SCALE, bool TWIDDLE>
+inline void _fm_fft_butterfly4(fixed<policy>* real, fixed<policy>* imag, ::std::size_t i0, ::std::size_t m, const typename policy::raw_t* cos, const typename policy::raw_t* sin, ::std::size_t j, int shift, ::std::make_unsigned_t<typename policy::raw_t>& bits) {
+	using raw_t = typename policy::raw_t;
+	const raw_t a0_re = _fm_fft_load<policy, SCALE>(real[i0], shift);
+	const raw_t a0_im = _fm_fft_load<policy, SCALE>(imag[i0], shift);
+	raw_t a1_re = _fm_fft_load<policy, SCALE>(real[i0 + m], shift);
+	raw_t a1_im = _fm_fft_load<policy, SCALE>(imag[i0 + m], shift);
+	raw_t a2_re = _fm_fft_load<policy, SCALE>(real[i0 + 2 * m], shift);
+	raw_t a2_im = _fm_fft_load<policy, SCALE>(imag[i0 + 2 * m], shift);
+	raw_t a3_re = _fm_fft_load<policy, SCALE>(real[i0 + 3 * m], shift);
+	raw_t a3_im = _fm_fft_load<policy, SCALE>(imag[i0 + 3 * m], shift);
+	if constexpr (TWIDDLE) {
+		_fm_fft_twiddle<policy, INVERSE>(a1_re, a1_im, cos[m + j], sin[m + j]);
+		_fm_fft_twiddle<policy, INVERSE>(a2_re, a2_im, cos[j], sin[j]);
+		_fm_fft_twiddle<policy, INVERSE>(a3_re, a3_im, cos[2 * m + j], sin[2 * m + j]);
+	}
+	const raw_t s0_re = a0_re + a1_re;
+	const raw_t s0_im = a0_im + a1_im;
+	const raw_t d0_re = a0_re - a1_re;
+	const raw_t d0_im = a0_im - a1_im;
+	const raw_t s1_re = a2_re + a3_re;
+	const raw_t s1_im = a2_im + a3_im;
+	// -i (a2 - a3) for the forward transform, i (a2 - a3) for the inverse.
+	raw_t d1_re = a2_im - a3_im;
+	raw_t d1_im = a3_re - a2_re;
+	if constexpr (INVERSE) {
+		d1_re = -d1_re;
+		d1_im = -d1_im;
+	}
+	const raw_t y[8] = {
+		s0_re + s1_re, s0_im + s1_im,
+		d0_re + d1_re, d0_im + d1_im,
+		s0_re - s1_re, s0_im - s1_im,
+		d0_re - d1_re, d0_im - d1_im,
+	};
+	for (::std::size_t k = 0; k < 4; ++k) {
+		_fm_fft_track(bits, y[2 * k]);
+		_fm_fft_track(bits, y[2 * k + 1]);
+		real[i0 + k * m] = fixed<policy>::from_raw(y[2 * k]);
+		imag[i0 + k * m] = fixed<policy>::from_raw(y[2 * k + 1]);
+	}
+}
+
+// One stage of span m with the stage's twiddle run. Inputs are scaled down by shift first;
+// the result is the tracked bits of the outputs.
+template <FixedPolicy policy, ::std::size_t N, bool RADIX4, bool INVERSE, bool SCALE>
+::std::make_unsigned_t<typename policy::raw_t> _fm_fft_stage(fixed<policy>* real, fixed<policy>* imag, ::std::size_t m, const typename policy::raw_t* cos, const typename policy::raw_t* sin, int shift) {
+	::std::make_unsigned_t<typename policy::raw_t> bits = 0;
+	for (::std::size_t group = 0; group < N; group += (RADIX4 ? 4 : 2) * m) {
+		if constexpr (RADIX4) {
+			_fm_fft_butterfly4<policy, INVERSE, SCALE, false>(real, imag, group, m, cos, sin, 0, shift, bits);
+			for (::std::size_t j = 1; j < m; ++j) {
+				_fm_fft_butterfly4<policy, INVERSE, SCALE, true>(real, imag, group + j, m, cos, sin, j, shift, bits);
+			}
+		} else {
+			_fm_fft_butterfly2<policy, INVERSE, SCALE, false>(real, imag, group, m, 0, 0, shift, bits);
+			for (::std::size_t j = 1; j < m; ++j) {
+				_fm_fft_butterfly2<policy, INVERSE, SCALE, true>(real, imag, group + j, m, cos[j], sin[j], shift, bits);
+			}
+		}
+	}
+	return bits;
+}
+
+// Scales, runs one stage, and updates the block exponent.
+template <FixedPolicy policy, ::std::size_t N, bool RADIX4, bool INVERSE>
+::std::make_unsigned_t<typename policy::raw_t> _fm_fft_scaled_stage(fixed<policy>* real, fixed<policy>* imag, ::std::size_t m, const typename policy::raw_t* cos, const typename policy::raw_t* sin, ::std::make_unsigned_t<typename policy::raw_t> bits, int& exponent) {
+	constexpr int BITS = sizeof(typename policy::raw_t) * CHAR_BIT;
+	// |x| <= 2^(BITS - 3) before a radix-2 butterfly bounds its outputs by (1 + sqrt(2)) times
+	// that, and |x| <= 2^(BITS - 4) bounds a radix-4 butterfly by (1 + 3 sqrt(2)) times that,
+	// both inside raw_t with room for the twiddle rounding.
+	constexpr int GUARD = RADIX4 ? BITS - 4 : BITS - 3;
+	const int shift = ::std::max(0, static_cast<int>(::std::bit_width(bits)) - GUARD);
+	exponent += shift;
+	if (shift == 0) {
+		return _fm_fft_stage<policy, N, RADIX4, INVERSE, false>(real, imag, m, cos, sin, 0);
+	}
+	return _fm_fft_stage<policy, N, RADIX4, INVERSE, true>(real, imag, m, cos, sin, shift);
+}
+
+template <fft_radix radix, bool INVERSE, FixedPolicy policy, ::std::size_t N>
+int _fm_fft(::std::span<fixed<policy>, N> real, ::std::span<fixed<policy>, N> imag) {
+	using raw_t = typename policy::raw_t;
+	constexpr auto& TABLE = _fm_fft_twiddle_table<raw_t, N, radix>;
+
+	::std::make_unsigned_t<raw_t> bits = 0;
+	for (::std::size_t i = 1, j = 0; i < N; ++i) {
+		::std::size_t bit = N >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j ^= bit;
+		if (i < j) {
+			::std::swap(real[i], real[j]);
+			::std::swap(imag[i], imag[j]);
+		}
+	}
+	for (::std::size_t i = 0; i < N; ++i) {
+		_fm_fft_track(bits, real[i].raw());
+		_fm_fft_track(bits, imag[i].raw());
+	}
+
+	int exponent = 0;
+	::std::size_t offset = 0;
+	::std::size_t m = 1;
+	if constexpr (radix == fft_radix::Radix2) {
+		for (; m < N; m *= 2) {
+			bits = _fm_fft_scaled_stage<policy, N, false, INVERSE>(real.data(), imag.data(), m, TABLE.cos + offset, TABLE.sin + offset, bits, exponent);
+			offset += m;
+		}
+	} else {
+		if constexpr (_fm_fft_first_radix4_span<N, radix>() == 2) {
+			// The first radix-2 stage only has the trivial twiddle.
+			bits = _fm_fft_scaled_stage<policy, N, false, INVERSE>(real.data(), imag.data(), 1, TABLE.cos, TABLE.sin, bits, exponent);
+			m = 2;
+		}
+		for (; m < N; m *= 4) {
+			bits = _fm_fft_scaled_stage<policy, N, true, INVERSE>(real.data(), imag.data(), m, TABLE.cos + offset, TABLE.sin + offset, bits, exponent);
+			offset += 3 * m;
+		}
+	}
+	if constexpr (INVERSE) {
+		exponent -= static_cast<int>(::std::bit_width(N)) - 1;
+	}
+	return exponent;
+}
+
+template <fft_radix radix, FixedPolicy policy, ::std::size_t N>
+	requires(FftSize<N> && _fm_fft_policy<policy>)
+int fft(::std::span<fixed<policy>, N> real, ::std::span<fixed<policy>, N> imag) {
+	return _fm_fft<radix, false>(real, imag);
+}
+
+template <fft_radix radix, FixedPolicy policy, ::std::size_t N>
+	requires(FftSize<N> && _fm_fft_policy<policy>)
+int ifft(::std::span<fixed<policy>, N> real, ::std::span<fixed<policy>, N> imag) {
+	return _fm_fft<radix, true>(real, imag);
+}
+
+} // namespace fixmath
@@ -0,0 +1,114 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <algorithm> // for std::copy, std::fill, std::min
+#include <new>       // for std::align_val_t
+#include <span>      // for std::span
+#include <vector>    // for std::vector
+#include "fixed.hpp"
+#include "fixmath_cpu.inl"
+
+namespace fixmath {
+
+// Allocator for buffers that SIMD kernels read one vector at a time.
+template <class T>
+struct _fm_aligned_allocator {
+	using value_type = T;
+	static constexpr ::std::size_t ALIGNMENT = 64;
+
+	_fm_aligned_allocator() = default;
+	template <class U>
+	constexpr _fm_aligned_allocator(const _fm_aligned_allocator<U>&) noexcept {}
+
+	T* allocate(::std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), ::std::align_val_t{ALIGNMENT})); }
+	void deallocate(T* p, ::std::size_t) noexcept { ::operator delete(p, ::std::align_val_t{ALIGNMENT}); }
+
+	template <class U>
+	constexpr bool operator==(const _fm_aligned_allocator<U>&) const noexcept { return true; }
+};
+
+template <class T>
+using _fm_aligned_vector = ::std::vector<T, _fm_aligned_allocator<T>>;
+
+// Finite impulse response filter y[n] = sum(taps[k] * x[n - k]). Each output is the exact
+// sum of the full-width products, rounded once to the sample format and saturated, or
+// wrapped in Ignore mode, as parallel::dot does. Coefficients may use another format than
+// the samples, for example Q2.14 taps on Q1.15 audio. Strict mode is not supported: its
+// special values have no meaning inside a filter history.
+template <FixedPolicy policy, FixedPolicy coefficient_policy = policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+class fir_filter {
+public:
+	using sample_t = fixed<policy>;
+	using coefficient_t = fixed<coefficient_policy>;
+
+	fir_filter() = default;
+	explicit fir_filter(::std::span<const coefficient_t> taps);
+
+	::std::size_t tap_count() const { return tap_count_; }
+
+	// Clear the history, as if every earlier sample was zero.
+	void reset();
+
+	sample_t process(sample_t x);
+	// out[i] is the output for in[i]. out must have in.size() elements and may be the same span as in.
+	void process(::std::span<const sample_t> in, ::std::span<sample_t> out);
+
+private:
+	using raw_t = typename policy::raw_t;
+	using coefficient_raw_t = typename coefficient_policy::raw_t;
+
+	// Samples per pass over the history buffer.
+	static constexpr ::std::size_t BLOCK = 4096;
+
+	::std::size_t tap_count_ = 0;
+	// Reversed taps, zero-padded to whole vectors, so output n is the dot product of taps_
+	// with buffer_[n, n + taps_.size()).
+	_fm_aligned_vector<coefficient_raw_t> taps_;
+	// The last tap_count - 1 samples, then room for one block and the padding.
+	_fm_aligned_vector<raw_t> buffer_;
+	bool simd_ = false;
+};
+
+// Second-order IIR section in direct form I:
+//   y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2] - a1 * y[n - 1] - a2 * y[n - 2]
+// with a0 normalized to 1. Like fir_filter, the five products are summed exactly and rounded
+// once, and coefficients may use a format with more integer bits than the samples.
+template <FixedPolicy policy, FixedPolicy coefficient_policy = policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+class biquad {
+public:
+	using sample_t = fixed<policy>;
+	using coefficient_t = fixed<coefficient_policy>;
+
+	biquad() = default;
+	biquad(coefficient_t b0, coefficient_t b1, coefficient_t b2, coefficient_t a1, coefficient_t a2);
+
+	// Clear the input and output history.
+	void reset();
+
+	sample_t process(sample_t x);
+	// Same span rules as fir_filter::process.
+	void process(::std::span<const sample_t> in, ::std::span<sample_t> out);
+
+private:
+	using raw_t = typename policy::raw_t;
+	using coefficient_raw_t = typename coefficient_policy::raw_t;
+
+	coefficient_raw_t b0_ = 0;
+	coefficient_raw_t b1_ = 0;
+	coefficient_raw_t b2_ = 0;
+	coefficient_raw_t a1_ = 0;
+	coefficient_raw_t a2_ = 0;
+	raw_t x1_ = 0;
+	raw_t x2_ = 0;
+	raw_t y1_ = 0;
+	raw_t y2_ = 0;
+};
+
+} // namespace fixmath
+
+#include "fixed_filter.inl"
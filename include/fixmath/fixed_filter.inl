@@ -0,0 +1,257 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// sum += a * b or sum -= a * b exactly, for raws of up to 64 bits.
+template <bool subtract, class T, class U>
+inline void _fm_accumulate_product(_fm_int192& sum, T a, U b) {
+	int64_t hi = 0;
+	int64_t lo = 0;
+	if constexpr (sizeof(T) < sizeof(int64_t) && sizeof(U) < sizeof(int64_t)) {
+		lo = int64_t{a} * b;
+		hi = lo >> 63;
+	} else {
+		lo = _fm_mul128(int64_t{a}, int64_t{b}, hi);
+	}
+	if constexpr (subtract) {
+		_fm_neg128(hi, lo);
+	}
+	_fm_add(sum, hi, static_cast<uint64_t>(lo));
+}
+
+// Exact sum of taps[k] * window[k] for k < count.
+template <class coefficient_raw_t, class raw_t>
+inline _fm_int192 _fm_fir_dot(const coefficient_raw_t* taps, const raw_t* window, ::std::size_t count) {
+	int64_t hi = 0;
+	int64_t lo = 0;
+	if constexpr (sizeof(coefficient_raw_t) <= sizeof(int16_t) && sizeof(raw_t) <= sizeof(int16_t)) {
+		// Products are at most 2^30, so 2^33 of them would be needed to overflow.
+		for (::std::size_t k = 0; k < count; ++k) {
+			lo += int32_t{taps[k]} * window[k];
+		}
+		return _fm_make_int192(lo);
+	} else if constexpr (sizeof(coefficient_raw_t) < sizeof(int64_t) && sizeof(raw_t) < sizeof(int64_t)) {
+		// Products have at most 62 bits, so a 128-bit sum cannot overflow.
+		for (::std::size_t k = 0; k < count; ++k) {
+			_fm_add128(hi, lo, int64_t{taps[k]} * window[k]);
+		}
+		return _fm_make_int192(hi, static_cast<uint64_t>(lo));
+	} else {
+		// As in _fm_reduce_dot: low product words with a carry count, high words in a 128-bit pair.
+		uint64_t low = 0;
+		uint64_t low_carries = 0;
+		for (::std::size_t k = 0; k < count; ++k) {
+			int64_t product_hi = 0;
+			const uint64_t product_lo = static_cast<uint64_t>(_fm_mul128(int64_t{taps[k]}, int64_t{window[k]}, product_hi));
+			low += product_lo;
+			low_carries += low < product_lo;
+			_fm_add128(hi, lo, product_hi);
+		}
+		_fm_add128(hi, lo, static_cast<int64_t>(low_carries));
+		return {{low, static_cast<uint64_t>(lo), static_cast<uint64_t>(hi)}};
+	}
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+void _fm_fir_block(const typename coefficient_policy::raw_t* taps, ::std::size_t tap_count, const typename policy::raw_t* window, fixed<policy>* out, ::std::size_t count) {
+	constexpr int SHIFT = static_cast<int>(fixed<coefficient_policy>::FRACTION_BITS);
+	for (::std::size_t i = 0; i < count; ++i) {
+		bool overflow = false;
+		out[i] = fixed<policy>::from_raw(_fm_narrow192<policy>(_fm_fir_dot(taps, window + i, tap_count), SHIFT, overflow));
+	}
+}
+
+// Samples and taps of the same 16- or 32-bit width, which the AVX2 kernels multiply lane by lane.
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+constexpr bool _fm_fir_simd = sizeof(typename policy::raw_t) == sizeof(typename coefficient_policy::raw_t) &&
+                              (sizeof(typename policy::raw_t) == sizeof(int16_t) || sizeof(typename policy::raw_t) == sizeof(int32_t));
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+// _fm_fir_dot for 16-bit raws and a count that is a multiple of 16. vpmaddwd adds two products
+// in 32 bits, which only -1.0 * -1.0 twice can overflow, so no tap may be INT16_MIN. Each pair
+// sum is widened before it is accumulated. Requires _fm_cpu().avx2.
+FIXMATH_TARGET("avx2") inline int64_t _fm_fir_dot_avx2(const int16_t* taps, const int16_t* window, ::std::size_t count) {
+	__m256i sum0 = _mm256_setzero_si256();
+	__m256i sum1 = _mm256_setzero_si256();
+	for (::std::size_t k = 0; k < count; k += 16) {
+		const __m256i t = _mm256_load_si256(reinterpret_cast<const __m256i*>(taps + k));
+		const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(window + k));
+		const __m256i pairs = _mm256_madd_epi16(t, w);
+		sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+		sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+	}
+	const __m256i sum = _mm256_add_epi64(sum0, sum1);
+	const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+	return _mm_cvtsi128_si64(half) + _mm_extract_epi64(half, 1);
+}
+
+// _fm_fir_dot for 32-bit raws and a count that is a multiple of 8. vpmuldq gives the 64-bit
+// products of the even and odd lanes. Their unsigned low words and signed high words are
+// summed in separate 64-bit lanes, which stays exact for any count below 2^31. Requires
+// _fm_cpu().avx2.
+FIXMATH_TARGET("avx2") inline _fm_int192 _fm_fir_dot_avx2(const int32_t* taps, const int32_t* window, ::std::size_t count) {
+	const __m256i low_mask = _mm256_set1_epi64x(0xffffffff);
+	__m256i low = _mm256_setzero_si256();
+	__m256i high = _mm256_setzero_si256();
+	for (::std::size_t k = 0; k < count; k += 8) {
+		const __m256i t = _mm256_load_si256(reinterpret_cast<const __m256i*>(taps + k));
+		const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(window + k));
+		const __m256i even = _mm256_mul_epi32(t, w);
+		const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(w, 32));
+		low = _mm256_add_epi64(low, _mm256_add_epi64(_mm256_and_si256(even, low_mask), _mm256_and_si256(odd, low_mask)));
+		// Sign-extended high words: the odd 32-bit halves of srai by 31 hold each sign.
+		const __m256i even_high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), _mm256_srai_epi32(even, 31), 0xaa);
+		const __m256i odd_high = _mm256_blend_epi32(_mm256_srli_epi64(odd, 32), _mm256_srai_epi32(odd, 31), 0xaa);
+		high = _mm256_add_epi64(high, _mm256_add_epi64(even_high, odd_high));
+	}
+	const __m128i low_half = _mm_add_epi64(_mm256_castsi256_si128(low), _mm256_extracti128_si256(low, 1));
+	const __m128i high_half = _mm_add_epi64(_mm256_castsi256_si128(high), _mm256_extracti128_si256(high, 1));
+	const uint64_t low_sum = static_cast<uint64_t>(_mm_cvtsi128_si64(low_half)) + static_cast<uint64_t>(_mm_extract_epi64(low_half, 1));
+	const int64_t high_sum = _mm_cvtsi128_si64(high_half) + _mm_extract_epi64(high_half, 1);
+	_fm_int192 sum = _fm_make_int192(high_sum >> 32, static_cast<uint64_t>(high_sum) << 32);
+	_fm_add(sum, 0, low_sum);
+	return sum;
+}
+
+// _fm_fir_block over the zero-padded taps. Requires _fm_cpu().avx2.
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+FIXMATH_TARGET("avx2") void _fm_fir_block_avx2(const typename coefficient_policy::raw_t* taps, ::std::size_t padded_count, const typename policy::raw_t* window, fixed<policy>* out, ::std::size_t count) {
+	constexpr int SHIFT = static_cast<int>(fixed<coefficient_policy>::FRACTION_BITS);
+	for (::std::size_t i = 0; i < count; ++i) {
+		_fm_int192 sum = {};
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int16_t)) {
+			sum = _fm_make_int192(_fm_fir_dot_avx2(taps, window + i, padded_count));
+		} else {
+			sum = _fm_fir_dot_avx2(taps, window + i, padded_count);
+		}
+		bool overflow = false;
+		out[i] = fixed<policy>::from_raw(_fm_narrow192<policy>(sum, SHIFT, overflow));
+	}
+}
+#endif
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+fir_filter<policy, coefficient_policy>::fir_filter(::std::span<const coefficient_t> taps)
+	: tap_count_(taps.size()) {
+	constexpr ::std::size_t LANES = 32 / sizeof(coefficient_raw_t);
+	const ::std::size_t padded = (tap_count_ + LANES - 1) / LANES * LANES;
+	taps_.assign(padded, 0);
+	for (::std::size_t k = 0; k < tap_count_; ++k) {
+		taps_[k] = taps[tap_count_ - 1 - k].raw();
+	}
+	// The padding taps are zero, so the samples they read past the block never matter.
+	const ::std::size_t history = tap_count_ == 0 ? 0 : tap_count_ - 1;
+	buffer_.assign(history + BLOCK + (padded - tap_count_), 0);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+	if constexpr (_fm_fir_simd<policy, coefficient_policy>) {
+		simd_ = _fm_cpu().avx2;
+		if constexpr (sizeof(coefficient_raw_t) == sizeof(int16_t)) {
+			for (const coefficient_raw_t tap : taps_) {
+				simd_ = simd_ && tap != ::std::numeric_limits<int16_t>::min();
+			}
+		}
+	}
+#endif
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+void fir_filter<policy, coefficient_policy>::reset() {
+	::std::fill(buffer_.begin(), buffer_.end(), raw_t{0});
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+auto fir_filter<policy, coefficient_policy>::process(sample_t x) -> sample_t {
+	sample_t y;
+	process(::std::span<const sample_t>(&x, 1), ::std::span<sample_t>(&y, 1));
+	return y;
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+void fir_filter<policy, coefficient_policy>::process(::std::span<const sample_t> in, ::std::span<sample_t> out) {
+	FIXMATH_ASSERT(in.size() == out.size(), "filter input and output must have the same length");
+	const ::std::size_t count = ::std::min(in.size(), out.size());
+	if (tap_count_ == 0) {
+		::std::fill(out.begin(), out.begin() + count, sample_t{});
+		return;
+	}
+	const ::std::size_t history = tap_count_ - 1;
+	for (::std::size_t first = 0; first < count; first += BLOCK) {
+		const ::std::size_t size = ::std::min(BLOCK, count - first);
+		// Copy the whole block before writing any output, so out may alias in.
+		raw_t* const samples = buffer_.data() + history;
+		for (::std::size_t i = 0; i < size; ++i) {
+			samples[i] = in[first + i].raw();
+		}
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (_fm_fir_simd<policy, coefficient_policy>) {
+			if (simd_) {
+				_fm_fir_block_avx2<policy, coefficient_policy>(taps_.data(), taps_.size(), buffer_.data(), out.data() + first, size);
+			} else {
+				_fm_fir_block<policy, coefficient_policy>(taps_.data(), tap_count_, buffer_.data(), out.data() + first, size);
+			}
+		} else
+#endif
+		{
+			_fm_fir_block<policy, coefficient_policy>(taps_.data(), tap_count_, buffer_.data(), out.data() + first, size);
+		}
+		::std::copy(buffer_.begin() + size, buffer_.begin() + size + history, buffer_.begin());
+	}
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+biquad<policy, coefficient_policy>::biquad(coefficient_t b0, coefficient_t b1, coefficient_t b2, coefficient_t a1, coefficient_t a2)
+	: b0_(b0.raw())
+	, b1_(b1.raw())
+	, b2_(b2.raw())
+	, a1_(a1.raw())
+	, a2_(a2.raw()) {}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+void biquad<policy, coefficient_policy>::reset() {
+	x1_ = 0;
+	x2_ = 0;
+	y1_ = 0;
+	y2_ = 0;
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+auto biquad<policy, coefficient_policy>::process(sample_t x) -> sample_t {
+	constexpr int SHIFT = static_cast<int>(coefficient_t::FRACTION_BITS);
+	_fm_int192 sum = {};
+	_fm_accumulate_product<false>(sum, b0_, x.raw());
+	_fm_accumulate_product<false>(sum, b1_, x1_);
+	_fm_accumulate_product<false>(sum, b2_, x2_);
+	_fm_accumulate_product<true>(sum, a1_, y1_);
+	_fm_accumulate_product<true>(sum, a2_, y2_);
+	bool overflow = false;
+	const raw_t y = _fm_narrow192<policy>(sum, SHIFT, overflow);
+	x2_ = x1_;
+	x1_ = x.raw();
+	y2_ = y1_;
+	y1_ = y;
+	return sample_t::from_raw(y);
+}
+
+template <FixedPolicy policy, FixedPolicy coefficient_policy>
+	requires(!policy::strict_mode && !coefficient_policy::strict_mode)
+void biquad<policy, coefficient_policy>::process(::std::span<const sample_t> in, ::std::span<sample_t> out) {
+	FIXMATH_ASSERT(in.size() == out.size(), "filter input and output must have the same length");
+	const ::std::size_t count = ::std::min(in.size(), out.size());
+	for (::std::size_t i = 0; i < count; ++i) {
+		out[i] = process(in[i]);
+	}
+}
+
+} // namespace fixmath
@@ -53,8 +53,8 @@ constexpr fixed<policy> fixed<policy>::quarter_pi()
 	return fixed::from_raw(static_cast<uraw_t>(fractional >> (63 - FRACTION_BITS)));
 }
 
-// clang-format off
-template<FixedPolicy policy>
+// clang-format off
+template<FixedPolicy policy>
 constexpr fixed<policy>::fixed(float value)
     : value(
         value != value
@@ -87,7 +87,7 @@ constexpr fixed<policy>::fixed(int32_t value)
             ? max_sat().raw()
         : value < MIN_REPRESENTABLE_INT32
             ? min_sat().raw()
-        : value * URATIO
+        : value * URATIO
     )
 {}
 // clang-format on
@@ -176,15 +176,19 @@ constexpr fixed<policy> operator+(fixed<policy> a, fixed<policy> b) {
 	using uraw_t = typename fixed::uraw_t;
 	if constexpr (policy::strict_mode) {
 		if (FIXMATH_UNLIKELY(a.is_nan() || b.is_nan())) {
+			FIXMATH_COUNT(AddSpecial);
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf() && b.is_inf())) {
+			FIXMATH_COUNT(AddSpecial);
 			return a == b ? a : fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			FIXMATH_COUNT(AddSpecial);
 			return a;
 		}
 		if (FIXMATH_UNLIKELY(b.is_inf())) {
+			FIXMATH_COUNT(AddSpecial);
 			return b;
 		}
 	}
@@ -198,10 +202,12 @@ constexpr fixed<policy> operator+(fixed<policy> a, fixed<policy> b) {
 		r = _fm_checked_add(a.raw(), b.raw(), overflow);
 		if (FIXMATH_UNLIKELY(overflow)) {
 			// same check in strict_mode or saturate_mode
+			FIXMATH_COUNT(AddSaturated);
 			return r > 0 ? fixed::min_sat() : fixed::max_sat();
 		}
 		if constexpr (policy::strict_mode) {
 			if (FIXMATH_UNLIKELY(r == fixed::nan().raw())) {
+				FIXMATH_COUNT(AddSaturated);
 				return fixed::min_sat();
 			}
 		}
@@ -216,15 +222,19 @@ constexpr fixed<policy> operator-(fixed<policy> a, fixed<policy> b) {
 	using uraw_t = typename fixed::uraw_t;
 	if constexpr (policy::strict_mode) {
 		if (FIXMATH_UNLIKELY(a.is_nan() || b.is_nan())) {
+			FIXMATH_COUNT(SubSpecial);
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf() && b.is_inf())) {
+			FIXMATH_COUNT(SubSpecial);
 			return a == b ? fixed::nan() : a;
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			FIXMATH_COUNT(SubSpecial);
 			return a;
 		}
 		if (FIXMATH_UNLIKELY(b.is_inf())) {
+			FIXMATH_COUNT(SubSpecial);
 			return -b;
 		}
 	}
@@ -238,10 +248,12 @@ constexpr fixed<policy> operator-(fixed<policy> a, fixed<policy> b) {
 		r = _fm_checked_sub(a.raw(), b.raw(), overflow);
 		if (FIXMATH_UNLIKELY(overflow)) {
 			// same check in strict_mode or saturate_mode
+			FIXMATH_COUNT(SubSaturated);
 			return r > 0 ? fixed::min_sat() : fixed::max_sat();
 		}
 		if constexpr (policy::strict_mode) {
 			if (FIXMATH_UNLIKELY(r == fixed::nan().raw())) {
+				FIXMATH_COUNT(SubSaturated);
 				return fixed::min_sat();
 			}
 		}
@@ -256,12 +268,15 @@ constexpr fixed<policy> operator*(fixed<policy> a, fixed<policy> b) {
 	using uraw_t = typename fixed::uraw_t;
 	if constexpr (policy::strict_mode) {
 		if (FIXMATH_UNLIKELY(a.is_nan() || b.is_nan())) {
+			FIXMATH_COUNT(MulSpecial);
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY((a.raw() == 0 && b.is_inf()) || (a.is_inf() && b.raw() == 0))) {
+			FIXMATH_COUNT(MulSpecial);
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf() || b.is_inf())) {
+			FIXMATH_COUNT(MulSpecial);
 			return (a.raw() ^ b.raw()) >= 0 ? fixed::inf() : -fixed::inf();
 		}
 	}
@@ -270,34 +285,46 @@ constexpr fixed<policy> operator*(fixed<policy> a, fixed<policy> b) {
 		// use extended 128bit multiplication
 		if constexpr (fixed::FRACTION_BITS < 62) {
 			if (FIXMATH_LIKELY(static_cast<int32_t>(a.raw()) == a.raw() && static_cast<int32_t>(b.raw()) == b.raw())) {
+				FIXMATH_COUNT(MulInt32);
 				r = a.raw() * b.raw();
 				r = _fm_div2n_round<policy, fixed::FRACTION_BITS>(r);
 				return fixed::from_raw(r);
 			}
 		}
+		FIXMATH_COUNT(MulWide);
 		raw_t rhi = 0;
-		r = _fm_mul128(a.raw(), b.raw(), rhi);
-		r = _fm_div2n_round<policy, fixed::FRACTION_BITS>(rhi, r, rhi);
+		if constexpr (FIXMATH_32BIT && fixed::FRACTION_BITS == 32) {
+			// no 64x64 multiply: assemble only the kept bits from 32x32 products
+			r = _fm_mulshr32<policy>(a.raw(), b.raw(), rhi);
+		} else {
+			r = _fm_mul128(a.raw(), b.raw(), rhi);
+			r = _fm_div2n_round<policy, fixed::FRACTION_BITS>(rhi, r, rhi);
+		}
 		if constexpr (!policy::ignore_mode) {
 			// check overfow
 			if (FIXMATH_UNLIKELY(rhi != (r >> 63))) {
+				FIXMATH_COUNT(MulSaturated);
 				return rhi >= 0 ? fixed::max_sat() : fixed::min_sat();
 			}
 			if constexpr (policy::strict_mode) {
 				if (FIXMATH_UNLIKELY(r == fixed::nan().raw())) {
+					FIXMATH_COUNT(MulSaturated);
 					return -fixed::inf();
 				}
 			}
 		}
 		return fixed::from_raw(r);
 	} else {
+		FIXMATH_COUNT(MulNarrow);
 		int64_t r64 = a.raw();
 		r64 *= b.raw();
 		r64 = _fm_div2n_round<policy, fixed::FRACTION_BITS>(r64);
 		if constexpr (!policy::ignore_mode) {
 			if (FIXMATH_UNLIKELY(r64 > fixed::max_sat().raw())) {
+				FIXMATH_COUNT(MulSaturated);
 				return fixed::max_sat();
 			} else if (FIXMATH_UNLIKELY(r64 < fixed::min_sat().raw())) {
+				FIXMATH_COUNT(MulSaturated);
 				return fixed::min_sat();
 			}
 		}
@@ -306,6 +333,69 @@ constexpr fixed<policy> operator*(fixed<policy> a, fixed<policy> b) {
 	}
 }
 
+// Rounded quotient (a << FRACTION_BITS) / b as a 128-bit pair, before any overflow check.
+// b must not be zero.
+template <FixedPolicy policy>
+constexpr int64_t _fm_div_quotient(typename policy::raw_t a, typename policy::raw_t b, int64_t& qhi) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	qhi = 0;
+	int64_t qlo = 0;
+	int64_t rem = 0;
+	if constexpr (sizeof(raw_t) == 8) {
+		// use extended int128 division
+		if constexpr (fixed::FRACTION_BITS < 62) {
+			const raw_t _ratio = fixed::URATIO;
+			const raw_t _simp_min = ::std::numeric_limits<raw_t>::min() / _ratio;
+			const raw_t _simp_max = ::std::numeric_limits<raw_t>::max() / _ratio;
+			if (FIXMATH_LIKELY(_simp_min < a && a <= _simp_max)) {
+				// check for simplified division
+				FIXMATH_COUNT(DivSimplified);
+				qlo = a;
+				qlo *= fixed::URATIO;
+				if constexpr (policy::rounding) {
+					rem = qlo % b;
+				}
+				qlo /= b;
+				qhi = qlo >> 63;
+			} else {
+				FIXMATH_COUNT(DivShlN);
+				const _int128_s _r = _fm_shlNdiv<fixed::FRACTION_BITS>(a, b, rem);
+				qlo = _r.lo;
+				qhi = _r.hi;
+			}
+		} else {
+			FIXMATH_COUNT(DivShlN);
+			const _int128_s _r = _fm_shlNdiv<fixed::FRACTION_BITS>(a, b, rem);
+			qlo = _r.lo;
+			qhi = _r.hi;
+		}
+	} else {
+		FIXMATH_COUNT(DivNarrow);
+		if constexpr (FIXMATH_32BIT) {
+			// no 64-bit divide instruction: one reciprocal division yields quotient and remainder
+			qlo = _fm_shlNdiv32<fixed::FRACTION_BITS>(a, b, rem);
+		} else {
+			qlo = a;
+			qlo *= fixed::URATIO;
+			if constexpr (policy::rounding) {
+				rem = qlo % b;
+			}
+			qlo /= b;
+		}
+		qhi = qlo >> 63;
+	}
+	if constexpr (policy::rounding) {
+		const uint64_t abs_rem = _fm_absraw(rem);
+		const uint64_t abs_b = _fm_absraw(b);
+		bool quo_nonneg = (a < 0) == (b < 0);
+		int64_t sign = quo_nonneg ? 1 : -1;
+		int64_t carry = (abs_rem * 2 > abs_b ? 1 : abs_rem * 2 == abs_b ? qlo & 1 : 0) * sign;
+		_fm_add128(qhi, qlo, carry);
+	}
+	return qlo;
+}
+
 template <FixedPolicy policy>
 constexpr fixed<policy> operator/(fixed<policy> a, fixed<policy> b) {
 	using fixed = fixed<policy>;
@@ -313,25 +403,35 @@ constexpr fixed<policy> operator/(fixed<policy> a, fixed<policy> b) {
 	using uraw_t = typename fixed::uraw_t;
 	if constexpr (policy::strict_mode) {
 		if (FIXMATH_UNLIKELY(a.is_nan() || b.is_nan())) {
+			FIXMATH_COUNT(DivSpecial);
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY((a.raw() == 0 && b.raw() == 0) || (a.is_inf() && b.is_inf()))) {
+			if (b.raw() == 0) {
+				FIXMATH_COUNT(DivByZero);
+			} else {
+				FIXMATH_COUNT(DivSpecial);
+			}
 			FIXMATH_ASSERT(b.raw() != 0, "division by 0");
 			return fixed::nan();
 		}
 		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			FIXMATH_COUNT(DivSpecial);
 			return b.raw() >= 0 ? a : -a;
 		}
 		if (FIXMATH_UNLIKELY(b.is_inf())) {
+			FIXMATH_COUNT(DivSpecial);
 			return 0;
 		}
 		if (FIXMATH_UNLIKELY(b.raw() == 0)) {
+			FIXMATH_COUNT(DivByZero);
 			FIXMATH_ERROR("division by 0");
 			return a.raw() > 0 ? fixed::inf() : -fixed::inf();
 		}
 	}
 	if constexpr (policy::saturation_mode) {
 		if (FIXMATH_UNLIKELY(b.raw() == 0)) {
+			FIXMATH_COUNT(DivByZero);
 			FIXMATH_ERROR("division by 0");
 			if (a.raw() == 0) {
 				return fixed::nan();
@@ -344,73 +444,23 @@ constexpr fixed<policy> operator/(fixed<policy> a, fixed<policy> b) {
 	}
 	if constexpr (policy::ignore_mode) {
 		if (FIXMATH_UNLIKELY(b.raw() == 0)) {
+			FIXMATH_COUNT(DivByZero);
 			FIXMATH_ERROR("division by 0");
 			return fixed::nan();
 		}
 	}
 	int64_t qhi = 0;
-	int64_t qlo = 0;
-	int64_t rem = 0;
-	if constexpr (sizeof(raw_t) == 8) {
-		// use extended int128 division
-		if constexpr (fixed::FRACTION_BITS < 62) {
-			const raw_t _ratio = fixed::URATIO;
-			const raw_t _simp_min = ::std::numeric_limits<raw_t>::min() / _ratio;
-			const raw_t _simp_max = ::std::numeric_limits<raw_t>::max() / _ratio;
-			if (FIXMATH_LIKELY(_simp_min < a.raw() && a.raw() <= _simp_max)) {
-				// check for simplified division
-				qlo = a.raw();
-				qlo *= fixed::URATIO;
-				if constexpr (policy::rounding) {
-					rem = qlo % b.raw();
-				}
-				qlo /= b.raw();
-				qhi = qlo >> 63;
-			} else {
-				_int128_s _r = {};
-				if constexpr (fixed::FRACTION_BITS == 32) {
-					// speed up for common cases
-					_r = _fm_shl32div(a.raw(), b.raw(), rem);
-				} else {
-					qlo = a.raw();
-					qlo *= fixed::URATIO;
-					_r = _fm_div128(a.raw() >> (fixed::ALL_BITS - fixed::FRACTION_BITS), qlo, b.raw(), rem);
-				}
-				qlo = _r.lo;
-				qhi = _r.hi;
-			}
-		} else {
-			_int128_s _r = {};
-			qlo = a.raw();
-			qlo *= fixed::URATIO;
-			_r = _fm_div128(a.raw() >> (fixed::ALL_BITS - fixed::FRACTION_BITS), qlo, b.raw(), rem);
-			qlo = _r.lo;
-			qhi = _r.hi;
-		}
-	} else {
-		qlo = a.raw();
-		qlo *= fixed::URATIO;
-		if constexpr (policy::rounding) {
-			rem = qlo % b.raw();
-		}
-		qlo /= b.raw();
-		qhi = qlo >> 63;
-	}
-	if constexpr (policy::rounding) {
-		const uint64_t abs_rem = _fm_absraw(rem);
-		const uint64_t abs_b = _fm_absraw(b.raw());
-		bool quo_nonneg = (a.raw() < 0) == (b.raw() < 0);
-		int64_t sign = quo_nonneg ? 1 : -1;
-		int64_t carry = (abs_rem * 2 > abs_b ? 1 : abs_rem * 2 == abs_b ? qlo & 1 : 0) * sign;
-		_fm_add128(qhi, qlo, carry);
-	}
+	const int64_t qlo = _fm_div_quotient<policy>(a.raw(), b.raw(), qhi);
 	if constexpr (!policy::ignore_mode) {
 		if (FIXMATH_UNLIKELY(qhi != (qlo >> 63))) {
+			FIXMATH_COUNT(DivSaturated);
 			return qhi >= 0 ? fixed::max_sat() : fixed::min_sat();
 		}
 		if (FIXMATH_UNLIKELY(qlo > fixed::max_sat().raw())) {
+			FIXMATH_COUNT(DivSaturated);
 			return fixed::max_sat();
 		} else if (FIXMATH_UNLIKELY(qlo < fixed::min_sat().raw())) {
+			FIXMATH_COUNT(DivSaturated);
 			return fixed::min_sat();
 		}
 	}
@@ -525,6 +575,203 @@ constexpr bool operator!=(T a, U b) {
 	return (fixed(a) <=> fixed(b)) != 0;
 }
 
+// Structural carrier for a fixed constant passed as a template argument to mul_by and
+// div_by; fixed itself keeps its raw value private and so cannot be one.
+template <FixedPolicy policy>
+struct _fm_fixed_constant {
+	using value_type = fixed<policy>;
+	typename value_type::raw_t raw;
+
+	constexpr _fm_fixed_constant(value_type value)
+		: raw(value.raw()) {}
+};
+
+// Exact wide result to fixed with the overflow handling of operator/.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_narrow_wide(int64_t hi, int64_t lo) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	if constexpr (!policy::ignore_mode) {
+		if (FIXMATH_UNLIKELY(hi != (lo >> 63))) {
+			return hi >= 0 ? fixed::max_sat() : fixed::min_sat();
+		}
+		if (FIXMATH_UNLIKELY(lo > fixed::max_sat().raw())) {
+			return fixed::max_sat();
+		} else if (FIXMATH_UNLIKELY(lo < fixed::min_sat().raw())) {
+			return fixed::min_sat();
+		}
+	}
+	return fixed::from_raw(static_cast<raw_t>(lo));
+}
+
+// a / 2^N rounded by policy for any N below the raw width.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr int64_t _fm_div2n_round_raw(typename fixed<policy>::raw_t a) {
+	if constexpr (N < 62) {
+		return _fm_div2n_round<policy, N>(int64_t{a});
+	} else {
+		int64_t hi = int64_t{a} >> 63;
+		return _fm_div2n_round<policy, N>(hi, int64_t{a}, hi);
+	}
+}
+
+// a * C with the result of operator*. The constant is analysed at compile time: a power of
+// two becomes a rounded shift, an integer becomes an integer multiply, and any other value
+// is reduced by its trailing zero bits to one multiply and a constant rounding shift.
+template <_fm_fixed_constant C>
+constexpr auto mul_by(typename decltype(C)::value_type a) -> typename decltype(C)::value_type {
+	using fixed = typename decltype(C)::value_type;
+	using policy = typename fixed::policy;
+	using raw_t = typename fixed::raw_t;
+	constexpr raw_t VALUE = C.raw;
+	constexpr uint64_t MAGNITUDE = _fm_absraw(VALUE);
+	constexpr ::std::size_t SHIFT = VALUE == 0 ? 0 : ::std::countr_zero(MAGNITUDE);
+	constexpr ::std::size_t FRACTION_BITS = fixed::FRACTION_BITS;
+	if constexpr (policy::strict_mode) {
+		if constexpr (fixed::from_raw(VALUE).is_nan() || fixed::from_raw(VALUE).is_inf()) {
+			return a * fixed::from_raw(VALUE);
+		}
+		if (FIXMATH_UNLIKELY(a.is_nan() || a.is_inf())) {
+			return a * fixed::from_raw(VALUE);
+		}
+	}
+	if constexpr (VALUE == 0) {
+		return fixed::from_raw(raw_t{0});
+	} else if constexpr (SHIFT >= FRACTION_BITS) {
+		// integer constant: exact product
+		constexpr raw_t FACTOR = VALUE >> FRACTION_BITS;
+		if constexpr (sizeof(raw_t) == 8) {
+			int64_t hi = 0;
+			const int64_t lo = _fm_mul128(a.raw(), FACTOR, hi);
+			return _fm_narrow_wide<policy>(hi, lo);
+		} else {
+			const int64_t r = int64_t{a.raw()} * FACTOR;
+			return _fm_narrow_wide<policy>(r >> 63, r);
+		}
+	} else if constexpr (MAGNITUDE == (uint64_t{1} << SHIFT)) {
+		// 2^-k: the magnitude only shrinks, so the rounded shift cannot overflow
+		const int64_t r = _fm_div2n_round_raw<policy, FRACTION_BITS - SHIFT>(a.raw());
+		return fixed::from_raw(static_cast<raw_t>(VALUE < 0 ? -r : r));
+	} else {
+		constexpr raw_t ODD = VALUE >> SHIFT;
+		if constexpr (sizeof(raw_t) == 8) {
+			if constexpr (!FIXMATH_64BIT && FRACTION_BITS - SHIFT < 62) {
+				// 64-bit targets get the full product from one instruction; elsewhere the product
+				// fits one word whenever |a| <= INT64_MAX / |ODD|
+				constexpr uint64_t ONE_WORD_LIMIT = uint64_t{::std::numeric_limits<int64_t>::max()} / _fm_absraw(ODD);
+				if (FIXMATH_LIKELY(_fm_absraw(a.raw()) <= ONE_WORD_LIMIT)) {
+					return fixed::from_raw(_fm_div2n_round<policy, FRACTION_BITS - SHIFT>(a.raw() * ODD));
+				}
+			}
+			int64_t hi = 0;
+			int64_t lo = _fm_mul128(a.raw(), ODD, hi);
+			lo = _fm_div2n_round<policy, FRACTION_BITS - SHIFT>(hi, lo, hi);
+			return _fm_narrow_wide<policy>(hi, lo);
+		} else {
+			const int64_t r = _fm_div2n_round<policy, FRACTION_BITS - SHIFT>(int64_t{a.raw()} * ODD);
+			return _fm_narrow_wide<policy>(r >> 63, r);
+		}
+	}
+}
+
+// a / C with the result of operator/. A power-of-two divisor becomes a shift. Any other
+// divisor of a 64-bit raw is divided with its reciprocal precomputed by
+// _fm_reciprocal_u64, which costs a few multiplies instead of a hardware or software
+// 128-by-64 division. Narrower raws divide their 64-bit dividend by the constant, which
+// the compiler lowers to a multiply by its magic number.
+template <_fm_fixed_constant C>
+constexpr auto div_by(typename decltype(C)::value_type a) -> typename decltype(C)::value_type {
+	using fixed = typename decltype(C)::value_type;
+	using policy = typename fixed::policy;
+	using raw_t = typename fixed::raw_t;
+	constexpr raw_t VALUE = C.raw;
+	static_assert(VALUE != 0, "division by 0");
+	constexpr uint64_t MAGNITUDE = _fm_absraw(VALUE);
+	constexpr ::std::size_t SHIFT = ::std::countr_zero(MAGNITUDE);
+	constexpr ::std::size_t FRACTION_BITS = fixed::FRACTION_BITS;
+	constexpr bool NEGATIVE = VALUE < 0;
+	if constexpr (policy::strict_mode) {
+		if constexpr (fixed::from_raw(VALUE).is_nan() || fixed::from_raw(VALUE).is_inf()) {
+			return a / fixed::from_raw(VALUE);
+		}
+		if (FIXMATH_UNLIKELY(a.is_nan() || a.is_inf())) {
+			return a / fixed::from_raw(VALUE);
+		}
+	}
+	int64_t hi = 0;
+	int64_t lo = 0;
+	if constexpr (MAGNITUDE == (uint64_t{1} << SHIFT)) {
+		if constexpr (SHIFT >= FRACTION_BITS) {
+			lo = _fm_div2n_round_raw<policy, SHIFT - FRACTION_BITS>(a.raw());
+			hi = lo >> 63;
+		} else {
+			// exact product a * 2^(F - k)
+			constexpr ::std::size_t N = FRACTION_BITS - SHIFT;
+			lo = static_cast<int64_t>(static_cast<uint64_t>(int64_t{a.raw()}) << N);
+			hi = int64_t{a.raw()} >> (64 - N);
+		}
+		if constexpr (NEGATIVE) {
+			_fm_neg128(hi, lo);
+		}
+		return _fm_narrow_wide<policy>(hi, lo);
+	} else if constexpr (sizeof(raw_t) == 8) {
+		if constexpr (FRACTION_BITS < 62) {
+			// same simplified range as operator/: the dividend fits one word and the compiler
+			// divides it by the constant with a multiply; |C| > 2 keeps the quotient in range
+			constexpr raw_t SIMPLIFIED_MAX = ::std::numeric_limits<raw_t>::max() / fixed::URATIO;
+			if (FIXMATH_LIKELY(-SIMPLIFIED_MAX <= a.raw() && a.raw() <= SIMPLIFIED_MAX)) {
+				const int64_t dividend = a.raw() * fixed::URATIO;
+				lo = dividend / VALUE;
+				if constexpr (policy::rounding) {
+					const uint64_t remainder = _fm_absraw(dividend % VALUE);
+					if (remainder * 2 > MAGNITUDE || (remainder * 2 == MAGNITUDE && (lo & 1))) {
+						lo += (a.raw() < 0) != NEGATIVE ? -1 : 1;
+					}
+				}
+				return fixed::from_raw(lo);
+			}
+		}
+		// |a| * 2^F / |C| in two digits: the high digit divides by the constant directly, the
+		// low digit uses the precomputed reciprocal of the normalized divisor
+		constexpr ::std::size_t NORMALIZE = ::std::countl_zero(MAGNITUDE);
+		constexpr uint64_t DIVISOR = MAGNITUDE << NORMALIZE;
+		constexpr uint64_t RECIPROCAL = _fm_reciprocal_u64(DIVISOR);
+		const uint64_t magnitude = _fm_absraw(a.raw());
+		uint64_t dividend_hi = 0;
+		uint64_t dividend_lo = magnitude;
+		if constexpr (FRACTION_BITS != 0) {
+			dividend_hi = magnitude >> (64 - FRACTION_BITS);
+			dividend_lo = magnitude << FRACTION_BITS;
+		}
+		uint64_t qhi = dividend_hi / MAGNITUDE;
+		uint64_t remainder = dividend_hi % MAGNITUDE;
+		remainder = (remainder << NORMALIZE) | (dividend_lo >> (63 - NORMALIZE) >> 1);
+		uint64_t qlo = _fm_udiv128_preinv(remainder, dividend_lo << NORMALIZE, DIVISOR, RECIPROCAL, remainder);
+		if constexpr (policy::rounding) {
+			remainder >>= NORMALIZE;
+			if (remainder * 2 > MAGNITUDE || (remainder * 2 == MAGNITUDE && (qlo & 1))) {
+				_fm_inc128(qhi, qlo);
+			}
+		}
+		hi = static_cast<int64_t>(qhi);
+		lo = static_cast<int64_t>(qlo);
+		if ((a.raw() < 0) != NEGATIVE) {
+			_fm_neg128(hi, lo);
+		}
+		return _fm_narrow_wide<policy>(hi, lo);
+	} else {
+		const int64_t dividend = int64_t{a.raw()} * fixed::URATIO;
+		lo = dividend / VALUE;
+		if constexpr (policy::rounding) {
+			const uint64_t remainder = _fm_absraw(dividend % VALUE);
+			if (remainder * 2 > MAGNITUDE || (remainder * 2 == MAGNITUDE && (lo & 1))) {
+				lo += (a.raw() < 0) != NEGATIVE ? -1 : 1;
+			}
+		}
+		return _fm_narrow_wide<policy>(lo >> 63, lo);
+	}
+}
+
 } // namespace fixmath
 
 namespace std {
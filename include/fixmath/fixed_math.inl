@@ -41,6 +41,11 @@ inline _fm_pio4_remainder _fm_rem_pio4(uraw_t magnitude) {
 	if (scaled_hi == 0) {
 		quotient = scaled_lo / PIO4;
 		remainder = scaled_lo % PIO4;
+	} else if constexpr (sizeof(uraw_t) == sizeof(uint64_t)) {
+		// The 64-bit PIO4 is normalized, so multiplying by its reciprocal and correcting
+		// replaces the hardware division with the same quotient and remainder.
+		constexpr uint64_t PIO4_RECIPROCAL = _fm_reciprocal_u64(PIO4);
+		quotient = _fm_udiv128_preinv(scaled_hi, scaled_lo, PIO4, PIO4_RECIPROCAL, remainder);
 	} else {
 		quotient = _fm_udiv128(scaled_hi, scaled_lo, PIO4, remainder);
 	}
@@ -82,7 +87,7 @@ typename fixed<policy>::raw_t _fm_horner_fast128(typename fixed<policy>::raw_t x
 }
 
 template <FixedPolicy policy, ::std::size_t N>
-typename fixed<policy>::raw_t _fm_horner_fast64(typename fixed<policy>::raw_t x, const typename fixed<policy>::raw_t (*coefficients)[N]) {
+constexpr typename fixed<policy>::raw_t _fm_horner_fast64(typename fixed<policy>::raw_t x, const typename fixed<policy>::raw_t (*coefficients)[N]) {
 	using fixed = fixed<policy>;
 	using raw_t = typename fixed::raw_t;
 	static_assert(fixed::FRACTION_BITS == 32);
@@ -99,19 +104,74 @@ typename fixed<policy>::raw_t _fm_horner_fast64(typename fixed<policy>::raw_t x,
 	return result;
 }
 
-template <FixedPolicy policy>
-	requires(fixed<policy>::FRACTION_BITS == 32)
-typename fixed<policy>::raw_t _fm_sincos(typename fixed<policy>::raw_t a, bool cosine) {
+// Sums COUNT ascending terms starting at FIRST of an Estrin evaluation: the lower power-of-two
+// block plus the remaining block scaled by powers[LEVEL] = x^(2^LEVEL). Recursing at compile time
+// keeps every stage in registers, which the tree needs to shorten the dependency chain.
+template <FixedPolicy policy, ::std::size_t N, ::std::size_t FIRST, ::std::size_t COUNT>
+typename fixed<policy>::raw_t _fm_estrin_terms(const typename fixed<policy>::raw_t* powers, const typename fixed<policy>::raw_t (*coefficients)[N]) {
+	if constexpr (COUNT == 1) {
+		return (*coefficients)[N - 1 - FIRST];
+	} else {
+		constexpr ::std::size_t LEVEL = ::std::bit_width(COUNT - 1) - 1;
+		constexpr ::std::size_t LOW = ::std::size_t(1) << LEVEL;
+		const auto low = _fm_estrin_terms<policy, N, FIRST, LOW>(powers, coefficients);
+		const auto high = _fm_estrin_terms<policy, N, FIRST + LOW, COUNT - LOW>(powers, coefficients);
+		return low + _fm_div2n_round<policy, fixed<policy>::FRACTION_BITS>(high * powers[LEVEL]);
+	}
+}
+
+// Estrin evaluation of the polynomial _fm_horner_fast64 evaluates, from the same descending
+// coefficient table. Terms are paired as t_2i + t_(2i+1) * p for p = x, x^2, x^4, ..., so the
+// multiplies of one level are independent and the dependency chain has about log2(N) stages
+// instead of N - 1. Rounding happens at other points than in Horner, so a table must be
+// verified for the scheme that evaluates it; see docs/internals/polynomial.md.
+template <FixedPolicy policy, ::std::size_t N>
+typename fixed<policy>::raw_t _fm_estrin_fast64(typename fixed<policy>::raw_t x, const typename fixed<policy>::raw_t (*coefficients)[N]) {
 	using fixed = fixed<policy>;
 	using raw_t = typename fixed::raw_t;
-	using uraw_t = typename fixed::uraw_t;
-	// See docs/internals/function-approximations.md for this Q32.32 candidate.
-	const static raw_t SIN_COEFFICIENTS[] = {
+	static_assert(fixed::FRACTION_BITS == 32);
+	static_assert(sizeof(raw_t) == sizeof(int64_t));
+	static_assert(N > 0);
+
+	// Offline range analysis must prove that each raw multiply and normalized addition fits raw_t.
+	if constexpr (N == 1) {
+		return (*coefficients)[0];
+	} else {
+		constexpr ::std::size_t LEVELS = ::std::bit_width(N - 1);
+		raw_t powers[LEVELS];
+		powers[0] = x;
+		for (::std::size_t i = 1; i < LEVELS; ++i) {
+			powers[i] = _fm_div2n_round<policy, fixed::FRACTION_BITS>(powers[i - 1] * powers[i - 1]);
+		}
+		return _fm_estrin_terms<policy, N, 0, N>(powers, coefficients);
+	}
+}
+
+// See docs/internals/function-approximations.md for these Q32.32 candidates. They live outside
+// _fm_sincos so that it stays constexpr, which the FFT twiddle tables rely on.
+template <class raw_t>
+struct _fm_sincos_coefficients {
+	static constexpr raw_t SIN[] = {
 		11654LL, -852064LL, 35791363LL, -715827879LL, 4294967296LL,
 	};
-	const static raw_t COS_COEFFICIENTS[] = {
+	static constexpr raw_t COS[] = {
 		104756LL, -5964319LL, 178956784LL, -2147483636LL, 4294967296LL,
 	};
+	static constexpr raw_t FAST_SIN[] = {
+		35010999LL, -715648083LL, 4294961143LL,
+	};
+	static constexpr raw_t FAST_COS[] = {
+		-5840220LL, 178912423LL, -2147479129LL, 4294967296LL,
+	};
+};
+
+template <precision tier, FixedPolicy policy>
+	requires(fixed<policy>::FRACTION_BITS == 32)
+constexpr typename fixed<policy>::raw_t _fm_sincos(typename fixed<policy>::raw_t a, bool cosine) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	using coefficients = _fm_sincos_coefficients<raw_t>;
 
 	if (a > fixed::quarter_pi().raw()) {
 		a = fixed::half_pi().raw() - a;
@@ -120,13 +180,22 @@ typename fixed<policy>::raw_t _fm_sincos(typename fixed<policy>::raw_t a, bool c
 	const uraw_t a_raw = static_cast<uraw_t>(a);
 	const raw_t square = static_cast<raw_t>(_fm_umul64<policy, fixed::FRACTION_BITS>(a_raw, a_raw));
 	if (cosine) {
-		return _fm_horner_fast64<policy>(square, &COS_COEFFICIENTS);
+		if constexpr (tier == precision::Fast) {
+			return _fm_horner_fast64<policy>(square, &coefficients::FAST_COS);
+		} else {
+			return _fm_horner_fast64<policy>(square, &coefficients::COS);
+		}
+	}
+	raw_t polynomial = 0;
+	if constexpr (tier == precision::Fast) {
+		polynomial = _fm_horner_fast64<policy>(square, &coefficients::FAST_SIN);
+	} else {
+		polynomial = _fm_horner_fast64<policy>(square, &coefficients::SIN);
 	}
-	const raw_t polynomial = _fm_horner_fast64<policy>(square, &SIN_COEFFICIENTS);
 	return static_cast<raw_t>(_fm_umul64<policy, fixed::FRACTION_BITS>(a_raw, static_cast<uraw_t>(polynomial)));
 }
 
-template <FixedPolicy policy>
+template <precision tier = precision::Precise, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 fixed<policy> sin(fixed<policy> a) {
 	using fixed = fixed<policy>;
@@ -157,12 +226,12 @@ fixed<policy> sin(fixed<policy> a) {
 		reduced = quarter_pi - remainder;
 	}
 
-	const raw_t result = _fm_sincos<policy>(reduced, false);
+	const raw_t result = _fm_sincos<tier, policy>(reduced, false);
 	const bool negate = negative != (octant >= 4);
 	return fixed::from_raw(negate ? -result : result);
 }
 
-template <FixedPolicy policy>
+template <precision tier = precision::Precise, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 fixed<policy> cos(fixed<policy> a) {
 	using fixed = fixed<policy>;
@@ -192,25 +261,33 @@ fixed<policy> cos(fixed<policy> a) {
 		reduced = quarter_pi - remainder;
 	}
 
-	const raw_t result = _fm_sincos<policy>(reduced, true);
+	const raw_t result = _fm_sincos<tier, policy>(reduced, true);
 	const bool negate = octant >= 2 && octant < 6;
 	return fixed::from_raw(negate ? -result : result);
 }
 
-template <FixedPolicy policy>
+template <precision tier, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 typename fixed<policy>::raw_t _fm_tan_kernel(typename fixed<policy>::raw_t a, bool retain_guard_bit) {
 	using fixed = fixed<policy>;
 	using raw_t = typename fixed::raw_t;
 	using uraw_t = typename fixed::uraw_t;
-	// See docs/internals/function-approximations.md for this Q32.32 candidate.
+	// See docs/internals/function-approximations.md for these Q32.32 candidates.
 	const static raw_t TAN_COEFFICIENTS[] = {
 		49715989LL, 90993159LL, 232123842LL, 572645510LL, 1431656075LL, 4294967295LL,
 	};
+	const static raw_t FAST_TAN_COEFFICIENTS[] = {
+		277031939LL, 566404673LL, 1431927672LL, 4294965467LL,
+	};
 
 	const uraw_t a_raw = static_cast<uraw_t>(a);
 	const raw_t square = static_cast<raw_t>(_fm_umul64<policy, fixed::FRACTION_BITS>(a_raw, a_raw));
-	const raw_t polynomial = _fm_horner_fast64<policy>(square, &TAN_COEFFICIENTS);
+	raw_t polynomial = 0;
+	if constexpr (tier == precision::Fast) {
+		polynomial = _fm_estrin_fast64<policy>(square, &FAST_TAN_COEFFICIENTS);
+	} else {
+		polynomial = _fm_estrin_fast64<policy>(square, &TAN_COEFFICIENTS);
+	}
 	const raw_t product = a * polynomial;
 	if (retain_guard_bit) {
 		return _fm_div2n_round<policy, fixed::FRACTION_BITS - 1>(product);
@@ -218,27 +295,37 @@ typename fixed<policy>::raw_t _fm_tan_kernel(typename fixed<policy>::raw_t a, bo
 	return _fm_div2n_round<policy, fixed::FRACTION_BITS>(product);
 }
 
-template <FixedPolicy policy>
+template <precision tier, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 typename fixed<policy>::raw_t _fm_cot_residual_kernel(typename fixed<policy>::raw_t a) {
 	using fixed = fixed<policy>;
 	using raw_t = typename fixed::raw_t;
 	using uraw_t = typename fixed::uraw_t;
-	// See docs/internals/function-approximations.md for this Q32.32 candidate.
+	// See docs/internals/function-approximations.md for these Q32.32 candidates.
 	const static raw_t COT_RESIDUAL_COEFFICIENTS[] = {
 		-949077LL,
 		-9084519LL,
 		-95443945LL,
 		-1431655764LL,
 	};
+	const static raw_t FAST_COT_RESIDUAL_COEFFICIENTS[] = {
+		-9386034LL,
+		-95419995LL,
+		-1431656055LL,
+	};
 
 	const uraw_t a_raw = static_cast<uraw_t>(a);
 	const raw_t square = static_cast<raw_t>(_fm_umul64<policy, fixed::FRACTION_BITS>(a_raw, a_raw));
-	const raw_t polynomial = _fm_horner_fast64<policy>(square, &COT_RESIDUAL_COEFFICIENTS);
+	raw_t polynomial = 0;
+	if constexpr (tier == precision::Fast) {
+		polynomial = _fm_horner_fast64<policy>(square, &FAST_COT_RESIDUAL_COEFFICIENTS);
+	} else {
+		polynomial = _fm_horner_fast64<policy>(square, &COT_RESIDUAL_COEFFICIENTS);
+	}
 	return _fm_div2n_round<policy, fixed::FRACTION_BITS>(a * polynomial);
 }
 
-template <FixedPolicy policy>
+template <precision tier = precision::Precise, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 fixed<policy> tan(fixed<policy> a) {
 	using fixed = fixed<policy>;
@@ -284,23 +371,23 @@ fixed<policy> tan(fixed<policy> a) {
 	const raw_t reciprocal_boundary = half_pi - DIRECT_BOUNDARY;
 	raw_t result = 0;
 	if (reduced <= DIRECT_BOUNDARY) {
-		result = _fm_tan_kernel<policy>(reduced, false);
+		result = _fm_tan_kernel<tier, policy>(reduced, false);
 	} else if (reduced == quarter_pi) {
 		result = static_cast<raw_t>(fixed::URATIO);
 	} else if (reduced <= quarter_pi) {
 		const raw_t reflected = quarter_pi - reduced;
-		const raw_t tangent = _fm_tan_kernel<policy>(reflected, true);
+		const raw_t tangent = _fm_tan_kernel<tier, policy>(reflected, true);
 		constexpr raw_t GUARDED_ONE = raw_t{1} << (fixed::FRACTION_BITS + 1);
 		result = (fixed::from_raw(GUARDED_ONE - tangent) / fixed::from_raw(GUARDED_ONE + tangent)).raw();
 	} else if (reduced < reciprocal_boundary) {
 		const raw_t reflected = reduced - quarter_pi;
-		const raw_t tangent = _fm_tan_kernel<policy>(reflected, true);
+		const raw_t tangent = _fm_tan_kernel<tier, policy>(reflected, true);
 		constexpr raw_t GUARDED_ONE = raw_t{1} << (fixed::FRACTION_BITS + 1);
 		result = (fixed::from_raw(GUARDED_ONE + tangent) / fixed::from_raw(GUARDED_ONE - tangent)).raw();
 	} else {
 		const raw_t distance = half_pi - reduced;
 		const fixed reciprocal = fixed(1) / fixed::from_raw(distance);
-		const fixed residual = fixed::from_raw(_fm_cot_residual_kernel<policy>(distance));
+		const fixed residual = fixed::from_raw(_fm_cot_residual_kernel<tier, policy>(distance));
 		result = (reciprocal + residual).raw();
 	}
 	const fixed result_magnitude = fixed::from_raw(result);
@@ -315,14 +402,14 @@ fixed<policy> tan(fixed<policy> a) {
 	return -result_magnitude;
 }
 
-template <FixedPolicy policy>
+template <precision tier = precision::Precise, FixedPolicy policy>
 	requires(fixed<policy>::FRACTION_BITS == 32)
 fixed<policy> cot(fixed<policy> a) {
 	using fixed = fixed<policy>;
 	if (a.raw() < 0) {
-		return tan(-fixed::half_pi() - a);
+		return tan<tier>(-fixed::half_pi() - a);
 	}
-	return tan(fixed::half_pi() - a);
+	return tan<tier>(fixed::half_pi() - a);
 }
 
 template <FixedPolicy policy>
@@ -399,4 +486,658 @@ constexpr fixed<policy> sqrt(fixed<policy> a) {
 	return fixed::from_raw(result);
 }
 
+// floor(sqrt(hi * 2^64 + lo)), digit by digit. round_up is set when the exact root is nearer
+// the next integer; the root of an integer is never exactly halfway between two.
+constexpr uint64_t _fm_isqrt128(uint64_t hi, uint64_t lo, bool& round_up) {
+	if (hi == 0) {
+		// one word: the root is built in place, one bit per step from the top
+		uint64_t root = 0;
+		for (uint64_t bit = lo == 0 ? 0 : uint64_t{1} << ((63 - ::std::countl_zero(lo)) & ~1); bit != 0; bit >>= 2) {
+			const uint64_t trial = root | bit;
+			const uint64_t mask = uint64_t{0} - (lo >= trial);
+			root >>= 1;
+			lo -= trial & mask;
+			root |= bit & mask;
+		}
+		round_up = lo > root;
+		return root;
+	}
+	const int skip = ::std::countl_zero(hi) / 2;
+	if (skip > 0) {
+		hi = (hi << (2 * skip)) | (lo >> (64 - 2 * skip));
+		lo <<= 2 * skip;
+	}
+	uint64_t root = 0;
+	// remainder <= 2 * root, so with its two new bits it stays below 2^67
+	uint64_t rem_hi = 0;
+	uint64_t rem_lo = 0;
+	for (int i = skip; i < 64; ++i) {
+		rem_hi = (rem_hi << 2) | (rem_lo >> 62);
+		rem_lo = (rem_lo << 2) | (hi >> 62);
+		hi = (hi << 2) | (lo >> 62);
+		lo <<= 2;
+		const uint64_t tester_hi = root >> 62;
+		const uint64_t tester_lo = (root << 2) | 1;
+		// branch-free, like the one-word loop: the digits of a root are as good as random
+		const bool borrow = rem_lo < tester_lo;
+		const uint64_t diff_hi = rem_hi - tester_hi - borrow;
+		const bool take = static_cast<int64_t>(diff_hi) >= 0;
+		const uint64_t mask = uint64_t{0} - take;
+		rem_hi = (diff_hi & mask) | (rem_hi & ~mask);
+		rem_lo -= tester_lo & mask;
+		root = (root << 1) | take;
+	}
+	// sqrt(v) >= root + 1/2 exactly when v - root^2 > root
+	round_up = rem_hi != 0 || rem_lo > root;
+	return root;
+}
+
+// sqrt of an exact sum of squares given in units of 2^-2F as hi * 2^64 + lo, which is the raw
+// of the root. Rounded like sqrt; a root above max_fix saturates, or wraps in Ignore mode.
+// too_large marks sums of 2^128 or more, whose root cannot be a raw.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_sqrt_sum(uint64_t hi, uint64_t lo, bool too_large) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	bool round_up = false;
+	uint64_t root = _fm_isqrt128(hi, lo, round_up);
+	if constexpr (policy::rounding) {
+		// a sum just below 2^128 rounds up to 2^64
+		too_large = too_large || (round_up && root == ::std::numeric_limits<uint64_t>::max());
+		root += round_up;
+	}
+	if constexpr (!policy::ignore_mode) {
+		if (FIXMATH_UNLIKELY(too_large || root > static_cast<uint64_t>(fixed::max_fix().raw()))) {
+			return fixed::max_sat();
+		}
+	}
+	return fixed::from_raw(static_cast<raw_t>(root));
+}
+
+// sqrt(values[0]^2 + ... + values[N-1]^2) from the exact sum of the squares, rounded once.
+// The squares are in units of 2^-2F, so the integer root of their sum is the raw of the
+// result. Each square is at most 2^126, so only the last carry of four can leave 128 bits.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> _fm_hypot(const fixed<policy> (&values)[N]) {
+	using fixed = fixed<policy>;
+	if constexpr (policy::strict_mode) {
+		// like std::hypot, an infinite value wins over nan
+		bool any_nan = false;
+		for (const fixed value : values) {
+			if (FIXMATH_UNLIKELY(value.is_inf())) {
+				return fixed::inf();
+			}
+			any_nan = any_nan || value.is_nan();
+		}
+		if (FIXMATH_UNLIKELY(any_nan)) {
+			return fixed::nan();
+		}
+	}
+	uint64_t hi = 0;
+	uint64_t lo = 0;
+	bool too_large = false;
+	for (const fixed value : values) {
+		const uint64_t magnitude = _fm_absraw(value.raw());
+		uint64_t square_hi = 0;
+		uint64_t square_lo = 0;
+		if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+			square_lo = magnitude * magnitude;
+		} else {
+			square_lo = _fm_umul128(magnitude, magnitude, square_hi);
+		}
+		bool carry = false;
+		bool carry_hi = false;
+		lo = _fm_checked_add(lo, square_lo, carry);
+		hi = _fm_checked_add(hi, square_hi + carry, carry_hi);
+		too_large = too_large || carry_hi;
+	}
+	return _fm_sqrt_sum<policy>(hi, lo, too_large);
+}
+
+// sqrt(a^2 + b^2) without forming a^2 or b^2 as fixed values: the sum is exact in 128 bits and
+// rounded once like sqrt, so it neither saturates early nor accumulates three roundings. Only
+// a result above max_fix saturates, or wraps in Ignore mode.
+template <FixedPolicy policy>
+constexpr fixed<policy> hypot(fixed<policy> a, fixed<policy> b) {
+	const fixed<policy> values[] = {a, b};
+	return _fm_hypot(values);
+}
+
+// sqrt(a^2 + b^2 + c^2), rounded once like the two-argument hypot.
+template <FixedPolicy policy>
+constexpr fixed<policy> hypot(fixed<policy> a, fixed<policy> b, fixed<policy> c) {
+	const fixed<policy> values[] = {a, b, c};
+	return _fm_hypot(values);
+}
+
+// 2^(2^-k) in Q1.63 rounded down and 2^(-2^-k) in Q0.64 rounded to nearest, for k = 1..32.
+// The roots are rounded down so that no product of them can exceed 2^64.
+struct _fm_exp2_constants {
+	static constexpr uint64_t ROOTS[32] = {
+		0xb504'f333'f9de'6484ULL, 0x9837'f051'8db8'a96fULL, 0x8b95'c1e3'ea8b'd6e6ULL, 0x85aa'c367'cc48'7b14ULL,
+		0x82cd'8698'ac2b'a1d7ULL, 0x8164'd1f3'bc03'0773ULL, 0x80b1'ed4f'd999'ab6cULL, 0x8058'd7d2'd5e5'f6b0ULL,
+		0x802c'6436'd0e0'4f50ULL, 0x8016'302f'1746'7628ULL, 0x800b'179c'8202'8fd0ULL, 0x8005'8baf'7fee'3b5dULL,
+		0x8002'c5d0'0fdc'fcb6ULL, 0x8001'62e6'1bed'4a48ULL, 0x8000'b172'92f7'02a3ULL, 0x8000'58b9'2abb'ae02ULL,
+		0x8000'2c5c'8dad'e4d7ULL, 0x8000'162e'44ea'f636ULL, 0x8000'0b17'21fa'7c18ULL, 0x8000'058b'90de'7e4cULL,
+		0x8000'02c5'c867'8f36ULL, 0x8000'0162'e431'db9fULL, 0x8000'00b1'7218'72d0ULL, 0x8000'0058'b90c'1aa8ULL,
+		0x8000'002c'5c86'05a4ULL, 0x8000'0016'2e43'00e6ULL, 0x8000'000b'1721'7ff8ULL, 0x8000'0005'8b90'bfddULL,
+		0x8000'0002'c5c8'5fe6ULL, 0x8000'0001'62e4'2ff1ULL, 0x8000'0000'b172'17f8ULL, 0x8000'0000'58b9'0bfcULL,
+	};
+	static constexpr uint64_t INVERSE_ROOTS[32] = {
+		0xb504'f333'f9de'6484ULL, 0xd744'fcca'd69d'6af4ULL, 0xeac0'c6e7'dd24'392fULL, 0xf525'7d15'2486'cc2cULL,
+		0xfa83'b2db'722a'033aULL, 0xfd3e'0c0c'f486'c175ULL, 0xfe9e'115c'7b8f'884cULL, 0xff4e'cb59'511e'c8a5ULL,
+		0xffa7'5652'1c8d'aed2ULL, 0xffd3'a751'c0f7'e10cULL, 0xffe9'd2b2'f7db'2756ULL, 0xfff4'e91b'ff1b'8c3eULL,
+		0xfffa'747e'a004'0664ULL, 0xfffd'3a3b'7814'eb54ULL, 0xfffe'9d1c'c60d'dab1ULL, 0xffff'4e8e'2587'9bfaULL,
+		0xffff'a747'0363'f451ULL, 0xffff'd3a3'7dda'0313ULL, 0xffff'e9d1'bdf7'03afULL, 0xffff'f4e8'debe'025eULL,
+		0xffff'fa74'6f4f'a150ULL, 0xffff'fd3a'37a3'f8b0ULL, 0xffff'fe9d'1bd1'065aULL, 0xffff'ff4e'8de8'45aeULL,
+		0xffff'ffa7'46f4'1377ULL, 0xffff'ffd3'a37a'05e4ULL, 0xffff'ffe9'd1bd'01fcULL, 0xffff'fff4'e8de'80c0ULL,
+		0xffff'fffa'746f'4051ULL, 0xffff'fffd'3a37'a025ULL, 0xffff'fffe'9d1b'd011ULL, 0xffff'ffff'4e8d'e808ULL,
+	};
+	// ln(2) in Q0.64, rounded down, and 2 / ln(2) in Q2.62
+	static constexpr uint64_t LN2 = 0xb172'17f7'd1cf'79abULL;
+	static constexpr uint64_t TWO_OVER_LN2 = 0xb8aa'3b29'5c17'f0bcULL;
+};
+
+// 2^(f / 2^64) in Q1.63: the product of the roots selected by the top 32 bits of f, times
+// 1 + t ln(2) for the remaining t < 2^-32, whose next term is below 2^-65. Every step rounds
+// down, so the result never exceeds the exact power and is at most about 2^-57 below it.
+inline uint64_t _fm_exp2_q63(uint64_t fraction) {
+	using constants = _fm_exp2_constants;
+	constexpr uint64_t ONE = uint64_t{1} << 63;
+	uint64_t factors[32];
+	for (int k = 0; k < 32; ++k) {
+		// a clear bit selects one, which keeps the selection free of branches on the input
+		const uint64_t mask = uint64_t{0} - ((fraction >> (63 - k)) & 1);
+		factors[k] = ONE + ((constants::ROOTS[k] - ONE) & mask);
+	}
+	// multiply as a balanced tree: the chain of dependent products is 5 long instead of 32
+	for (int width = 16; width != 0; width /= 2) {
+		for (int k = 0; k < width; ++k) {
+			uint64_t hi = 0;
+			const uint64_t lo = _fm_umul128(factors[k], factors[k + width], hi);
+			factors[k] = (hi << 1) | (lo >> 63);
+		}
+	}
+	const uint64_t power = factors[0];
+	// t ln(2) 2^96 fits a word because t < 2^-32
+	uint64_t scaled_tail = 0;
+	_fm_umul128((fraction & 0xFFFF'FFFF) << 32, constants::LN2, scaled_tail);
+	uint64_t increment = 0;
+	_fm_umul128(power, scaled_tail, increment);
+	return power + (increment >> 32);
+}
+
+// log2(m / 2^63) in Q0.64 for a normalized m: divide out each root that still fits, which
+// sets the bits of the logarithm from the top, then take log2(1 + u) = u / ln(2) for the
+// remaining u < 2^-32, whose next term is below 2^-64. The error is below 2^-58.
+inline uint64_t _fm_log2_q64(uint64_t mantissa) {
+	using constants = _fm_exp2_constants;
+	constexpr uint64_t ONE = uint64_t{1} << 63;
+	uint64_t bits = 0;
+	for (int k = 0; k < 32; ++k) {
+		const uint64_t take = mantissa >= constants::ROOTS[k];
+		const uint64_t mask = uint64_t{0} - take;
+		uint64_t quotient = 0;
+		_fm_umul128(mantissa, constants::INVERSE_ROOTS[k], quotient);
+		mantissa = (quotient & mask) | (mantissa & ~mask);
+		bits |= take << (63 - k);
+	}
+	// a quotient rounded just below one leaves no remainder
+	const uint64_t excess = mantissa > ONE ? mantissa - ONE : 0;
+	uint64_t hi = 0;
+	const uint64_t lo = _fm_umul128(excess, constants::TWO_OVER_LN2, hi);
+	const uint64_t tail = (hi << 2) | (lo >> 62);
+	bool carry = false;
+	const uint64_t fraction = _fm_checked_add(bits, tail, carry);
+	return carry ? ~uint64_t{0} : fraction;
+}
+
+// Round the magnitude hi * 2^(64 + exponent) + lo * 2^exponent to a raw as the policy does.
+// hi must have its top bit set. inexact means that the exact magnitude is slightly larger,
+// which decides a discarded part of exactly one half. Magnitudes outside the range of the
+// raw saturate to max_sat/min_sat, or wrap in Ignore mode, like the scalar operators.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_round_mantissa(uint64_t hi, uint64_t lo, int64_t exponent, bool inexact, bool negative) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	const uint64_t limit = negative ? static_cast<uint64_t>(_fm_absraw(fixed::min_fix().raw())) : static_cast<uint64_t>(fixed::max_fix().raw());
+	uint64_t magnitude = 0;
+	bool overflow = false;
+	if (exponent > -64) {
+		// at least 2^64, beyond every raw; Ignore mode keeps the low bits
+		overflow = true;
+		if (exponent < 0) {
+			magnitude = (lo >> -exponent) | (hi << (64 + exponent));
+		} else if (exponent < 64) {
+			magnitude = lo << exponent;
+		}
+	} else {
+		const int64_t shift = -exponent - 64;
+		uint64_t rest = 0;
+		bool sticky = inexact;
+		if (shift == 0) {
+			magnitude = hi;
+			rest = lo;
+		} else if (shift < 64) {
+			magnitude = hi >> shift;
+			rest = (hi << (64 - shift)) | (lo >> shift);
+			sticky = sticky || (lo << (64 - shift)) != 0;
+		} else if (shift == 64) {
+			rest = hi;
+			sticky = sticky || lo != 0;
+		} else {
+			// below one half
+			sticky = true;
+		}
+		if constexpr (policy::rounding) {
+			const uint64_t half = uint64_t{1} << 63;
+			magnitude += rest > half || (rest == half && (sticky || (magnitude & 1)));
+		}
+		overflow = magnitude > limit;
+	}
+	if constexpr (!policy::ignore_mode) {
+		if (FIXMATH_UNLIKELY(overflow)) {
+			return negative ? fixed::min_sat() : fixed::max_sat();
+		}
+	}
+	const uraw_t bits = static_cast<uraw_t>(magnitude);
+	return fixed::from_raw(static_cast<raw_t>(negative ? static_cast<uraw_t>(uraw_t{0} - bits) : bits));
+}
+
+// 2^a. The fraction of a selects the product of exact-to-2^-57 roots and the integer part
+// scales it, so the result is rounded once from a value within 2^-57 of 2^a.
+template <FixedPolicy policy>
+fixed<policy> exp2(fixed<policy> a) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(a.is_nan())) {
+			return fixed::nan();
+		}
+		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			return a.raw() > 0 ? fixed::inf() : fixed::from_raw(raw_t{0});
+		}
+	}
+	const int64_t integer = a.raw() >> fixed::FRACTION_BITS;
+	uint64_t fraction = 0;
+	if constexpr (fixed::FRACTION_BITS != 0) {
+		fraction = static_cast<uint64_t>(static_cast<uraw_t>(a.raw() & fixed::FRACTION_MASK)) << (64 - fixed::FRACTION_BITS);
+	}
+	// 2^a = power 2^(integer - 63), so the raw is power 2^(integer - 63 + F)
+	return _fm_round_mantissa<policy>(_fm_exp2_q63(fraction), 0, integer - 127 + fixed::FRACTION_BITS, fraction != 0, false);
+}
+
+// log2(a) for a > 0, rounded once from a value within 2^-58 of the exact logarithm. log2(0) is
+// -inf in strict mode and min_sat otherwise; a negative argument reports a domain error.
+template <FixedPolicy policy>
+	requires(fixed<policy>::FRACTION_BITS <= 56)
+fixed<policy> log2(fixed<policy> a) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(a.is_nan())) {
+			return fixed::nan();
+		}
+		if (FIXMATH_UNLIKELY(a.is_inf() && a.raw() > 0)) {
+			return fixed::inf();
+		}
+	}
+	if (FIXMATH_UNLIKELY(a.raw() <= 0)) {
+		if (a.raw() < 0) {
+			if constexpr (!policy::ignore_mode) {
+				FIXMATH_ERROR("log2(<0)");
+			}
+			if constexpr (policy::strict_mode) {
+				return fixed::nan();
+			}
+		}
+		return fixed::min_sat();
+	}
+	const uint64_t magnitude = static_cast<uint64_t>(a.raw());
+	const int shift = ::std::countl_zero(magnitude);
+	const uint64_t fraction = _fm_log2_q64(magnitude << shift);
+	// a = (magnitude << shift) 2^(-63) 2^(63 - shift - F)
+	const int64_t integer = 63 - shift - fixed::FRACTION_BITS;
+	uint64_t rounded = 0;
+	if constexpr (fixed::FRACTION_BITS != 0) {
+		rounded = fraction >> (64 - fixed::FRACTION_BITS);
+	}
+	const uint64_t rest = fraction << fixed::FRACTION_BITS;
+	if constexpr (policy::rounding) {
+		// log2 of a raw is irrational unless the raw is a power of two, so a discarded half
+		// is never exact and rounds up
+		rounded += rest >= (uint64_t{1} << 63);
+	}
+	int64_t result = integer * (int64_t{1} << fixed::FRACTION_BITS) + static_cast<int64_t>(rounded);
+	if constexpr (!policy::rounding) {
+		// the split above floors; truncate the magnitude of a negative logarithm instead
+		result += result < 0 && rest != 0;
+	}
+	if constexpr (!policy::ignore_mode) {
+		if (FIXMATH_UNLIKELY(result < fixed::min_fix().raw())) {
+			return fixed::min_sat();
+		}
+		if (FIXMATH_UNLIKELY(result > fixed::max_fix().raw())) {
+			return fixed::max_sat();
+		}
+	}
+	return fixed::from_raw(static_cast<raw_t>(result));
+}
+
+// floor(cbrt(v)) by integer Newton iteration from above: x' = (2x + v / x^2) / 3 never drops
+// below the root, and decreases until it reaches it.
+constexpr uint64_t _fm_icbrt64(uint64_t v) {
+	if (v == 0) {
+		return 0;
+	}
+	// 2^ceil(bits / 3) is at least the root
+	uint64_t root = uint64_t{1} << ((64 - ::std::countl_zero(v) + 2) / 3);
+	for (;;) {
+		const uint64_t next = (2 * root + v / (root * root)) / 3;
+		if (next >= root) {
+			return root;
+		}
+		root = next;
+	}
+}
+
+// floor(cbrt(hi * 2^64 + lo)). round_up is set when the exact root is nearer the next integer;
+// the cube root of an integer is never exactly halfway between two.
+inline uint64_t _fm_icbrt128(uint64_t hi, uint64_t lo, bool& round_up) {
+	uint64_t root = 0;
+	if (hi == 0) {
+		root = _fm_icbrt64(lo);
+	} else {
+		// Seed with (cbrt(top) + 1) 2^k for the top 61 to 63 bits, top = v / 2^3k. That is at
+		// least the root and within 2^-20 of it, so Newton needs about two more steps.
+		const int k = (128 - ::std::countl_zero(hi) - 61) / 3;
+		const int shift = 3 * k;
+		const uint64_t top = shift < 64 ? (lo >> shift) | (hi << (64 - shift)) : hi >> (shift - 64);
+		root = (_fm_icbrt64(top) + 1) << k;
+		for (;;) {
+			// v / x^2 as (v / x) / x; near the root the quotient is near x, so it fits a word
+			uint64_t remainder = 0;
+			const uint64_t quotient_hi = hi / root;
+			const uint64_t quotient_lo = _fm_udiv128(hi % root, lo, root, remainder);
+			const uint64_t quotient = _fm_udiv128(quotient_hi, quotient_lo, root, remainder);
+			const uint64_t next = (2 * root + quotient) / 3;
+			if (next >= root) {
+				break;
+			}
+			root = next;
+		}
+	}
+	// cbrt(v) > root + 1/2 exactly when 8 (v - root^3) > 12 root^2 + 6 root + 1
+	uint64_t square_hi = 0;
+	const uint64_t square_lo = _fm_umul128(root, root, square_hi);
+	uint64_t cube_hi = 0;
+	const uint64_t cube_lo = _fm_umul128(square_lo, root, cube_hi);
+	cube_hi += square_hi * root;
+	bool borrow = false;
+	const uint64_t rest_lo = _fm_checked_sub(lo, cube_lo, borrow);
+	const uint64_t rest_hi = hi - cube_hi - borrow;
+	// both sides are below 2^91
+	const uint64_t left_hi = (rest_hi << 3) | (rest_lo >> 61);
+	const uint64_t left_lo = rest_lo << 3;
+	uint64_t right_hi = 0;
+	uint64_t right_lo = _fm_umul128(square_lo, 12, right_hi);
+	bool carry = false;
+	right_lo = _fm_checked_add(right_lo, 6 * root + 1, carry);
+	right_hi += square_hi * 12 + carry;
+	round_up = left_hi > right_hi || (left_hi == right_hi && left_lo > right_lo);
+	return root;
+}
+
+// cbrt(a), rounded once: the raw is the integer cube root of raw * 2^2F, which must fit
+// 128 bits.
+template <FixedPolicy policy>
+	requires(fixed<policy>::ALL_BITS + 2 * fixed<policy>::FRACTION_BITS <= 128)
+fixed<policy> cbrt(fixed<policy> a) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(a.is_nan() || a.is_inf())) {
+			return a;
+		}
+	}
+	const bool negative = a.raw() < 0;
+	const uint64_t magnitude = static_cast<uint64_t>(_fm_absraw(a.raw()));
+	constexpr int SHIFT = 2 * fixed::FRACTION_BITS;
+	uint64_t hi = 0;
+	uint64_t lo = 0;
+	if constexpr (SHIFT == 0) {
+		lo = magnitude;
+	} else if constexpr (SHIFT < 64) {
+		lo = magnitude << SHIFT;
+		hi = magnitude >> (64 - SHIFT);
+	} else {
+		hi = magnitude << (SHIFT - 64);
+	}
+	bool round_up = false;
+	uint64_t root = _fm_icbrt128(hi, lo, round_up);
+	if constexpr (policy::rounding) {
+		root += round_up;
+	}
+	if constexpr (!policy::ignore_mode) {
+		// only a root rounded up to one can leave the range, in a format without integer bits
+		const uint64_t limit = negative ? static_cast<uint64_t>(_fm_absraw(fixed::min_fix().raw())) : static_cast<uint64_t>(fixed::max_fix().raw());
+		if (FIXMATH_UNLIKELY(root > limit)) {
+			return negative ? fixed::min_sat() : fixed::max_sat();
+		}
+	}
+	const uraw_t bits = static_cast<uraw_t>(root);
+	return fixed::from_raw(static_cast<raw_t>(negative ? static_cast<uraw_t>(uraw_t{0} - bits) : bits));
+}
+
+// Binary floating-point value hi * 2^(64 + exponent) + lo * 2^exponent with the top bit of hi
+// set, for exponentiation without intermediate rounding to the format.
+struct _fm_mantissa128 {
+	uint64_t hi;
+	uint64_t lo;
+	int64_t exponent;
+};
+
+// a * b with the 256-bit product truncated to a normalized 128-bit mantissa. inexact is set
+// when the dropped bits are not all zero.
+inline _fm_mantissa128 _fm_multiply(const _fm_mantissa128& a, const _fm_mantissa128& b, bool& inexact) {
+	uint64_t ll_hi = 0;
+	const uint64_t w0 = _fm_umul128(a.lo, b.lo, ll_hi);
+	uint64_t lh_hi = 0;
+	const uint64_t lh_lo = _fm_umul128(a.lo, b.hi, lh_hi);
+	uint64_t hl_hi = 0;
+	const uint64_t hl_lo = _fm_umul128(a.hi, b.lo, hl_hi);
+	uint64_t hh_hi = 0;
+	const uint64_t hh_lo = _fm_umul128(a.hi, b.hi, hh_hi);
+	bool carry1 = false;
+	bool carry2 = false;
+	bool carry3 = false;
+	bool carry4 = false;
+	bool carry5 = false;
+	uint64_t w1 = _fm_checked_add(ll_hi, lh_lo, carry1);
+	w1 = _fm_checked_add(w1, hl_lo, carry2);
+	uint64_t w2 = _fm_checked_add(hh_lo, lh_hi, carry3);
+	w2 = _fm_checked_add(w2, hl_hi, carry4);
+	w2 = _fm_checked_add(w2, uint64_t{carry1} + carry2, carry5);
+	const uint64_t w3 = hh_hi + carry3 + carry4 + carry5;
+	// the product of two values in [2^127, 2^128) lies in [2^254, 2^256)
+	if (w3 >> 63) {
+		inexact = inexact || (w1 | w0) != 0;
+		return {w3, w2, a.exponent + b.exponent + 128};
+	}
+	inexact = inexact || ((w1 << 1) | w0) != 0;
+	return {(w3 << 1) | (w2 >> 63), (w2 << 1) | (w1 >> 63), a.exponent + b.exponent + 127};
+}
+
+// a^n by binary exponentiation of 128-bit mantissas, rounded once. Every step rounds down, so
+// the result is rounded from a value within about n 2^-127 of the exact power and is correctly
+// rounded unless that power lies closer than this to a rounding boundary. A negative n
+// raises the reciprocal of a. ipow(a, 0) is one; ipow(0, n) for n < 0 is a division by zero.
+template <FixedPolicy policy>
+fixed<policy> ipow(fixed<policy> a, int32_t n) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	constexpr uint64_t ONE = uint64_t{1} << 63;
+	if (n == 0) {
+		return fixed(1);
+	}
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(a.is_nan())) {
+			return fixed::nan();
+		}
+		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			if (n < 0) {
+				return fixed::from_raw(raw_t{0});
+			}
+			return a.raw() < 0 && (n & 1) ? -fixed::inf() : fixed::inf();
+		}
+	}
+	if (FIXMATH_UNLIKELY(a.raw() == 0)) {
+		if (n > 0) {
+			return a;
+		}
+		FIXMATH_ERROR("division by 0");
+		if constexpr (policy::strict_mode) {
+			return fixed::inf();
+		} else if constexpr (policy::saturation_mode) {
+			return fixed::max_sat();
+		} else {
+			return fixed::nan();
+		}
+	}
+	const uint64_t magnitude = static_cast<uint64_t>(_fm_absraw(a.raw()));
+	const int shift = ::std::countl_zero(magnitude);
+	// a = (magnitude << shift) 2^(-shift - F)
+	_fm_mantissa128 base = {magnitude << shift, 0, -int64_t{shift} - fixed::FRACTION_BITS - 64};
+	bool inexact = false;
+	uint64_t count = static_cast<uint64_t>(n);
+	if (n < 0) {
+		count = 0 - count;
+		// 1 / (m 2^(64 + e)) = (2^191 / m) 2^(-255 - e), and 2^127 2^(-254 - e) for m = 2^63
+		if (base.hi == ONE) {
+			base.exponent = -254 - base.exponent;
+		} else {
+			uint64_t remainder = 0;
+			const uint64_t quotient_hi = _fm_udiv128(ONE, 0, base.hi, remainder);
+			const uint64_t quotient_lo = _fm_udiv128(remainder, 0, base.hi, remainder);
+			inexact = remainder != 0;
+			base = {quotient_hi, quotient_lo, -255 - base.exponent};
+		}
+	}
+	_fm_mantissa128 result = {ONE, 0, -127};
+	for (;;) {
+		if (count & 1) {
+			result = _fm_multiply(result, base, inexact);
+		}
+		count >>= 1;
+		if (count == 0) {
+			break;
+		}
+		base = _fm_multiply(base, base, inexact);
+	}
+	const bool negative = a.raw() < 0 && (n & 1);
+	return _fm_round_mantissa<policy>(result.hi, result.lo, result.exponent + fixed::FRACTION_BITS, inexact, negative);
+}
+
+// a^b = 2^(b log2(a)) for a > 0, with log2(a) carried in Q7.56 and the product exact, so the
+// result is rounded once from a value within about (|b| 2^-56 + 2^-57) times a^b. An integral b
+// is passed to ipow, which also defines a^b for a <= 0. A negative a with a non-integral b
+// reports a domain error.
+template <FixedPolicy policy>
+	requires(fixed<policy>::FRACTION_BITS <= 56)
+fixed<policy> pow(fixed<policy> a, fixed<policy> b) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	const raw_t zero = 0;
+	if constexpr (policy::strict_mode) {
+		// as std::pow, a^0 and 1^b are one even for nan
+		if (b.raw() == 0) {
+			return fixed(1);
+		}
+		if constexpr (fixed::INTEGER_BITS >= 2) {
+			if (a == fixed(1)) {
+				return a;
+			}
+		}
+		if (FIXMATH_UNLIKELY(a.is_nan() || b.is_nan())) {
+			return fixed::nan();
+		}
+		if (FIXMATH_UNLIKELY(b.is_inf())) {
+			const fixed magnitude = a.raw() < 0 ? -a : a;
+			if constexpr (fixed::INTEGER_BITS >= 2) {
+				if (magnitude == fixed(1)) {
+					return magnitude;
+				}
+				// grows without bound exactly when |a| > 1 and b = +inf, or |a| < 1 and b = -inf
+				return (magnitude > fixed(1)) == (b.raw() > 0) ? fixed::inf() : fixed::from_raw(zero);
+			} else {
+				return b.raw() > 0 ? fixed::from_raw(zero) : fixed::inf();
+			}
+		}
+	}
+	const raw_t integer = b.raw() >> fixed::FRACTION_BITS;
+	const bool integral = (b.raw() & fixed::FRACTION_MASK) == 0;
+	if (integral && ::std::numeric_limits<int32_t>::min() <= integer && integer <= ::std::numeric_limits<int32_t>::max()) {
+		return ipow(a, static_cast<int32_t>(integer));
+	}
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(a.is_inf())) {
+			return b.raw() > 0 ? fixed::inf() : fixed::from_raw(zero);
+		}
+	}
+	if (FIXMATH_UNLIKELY(a.raw() == 0)) {
+		if (b.raw() > 0) {
+			return a;
+		}
+		FIXMATH_ERROR("division by 0");
+		if constexpr (policy::strict_mode) {
+			return fixed::inf();
+		} else if constexpr (policy::saturation_mode) {
+			return fixed::max_sat();
+		} else {
+			return fixed::nan();
+		}
+	}
+	// an integral b too large for ipow only decides the sign
+	const bool negative = a.raw() < 0 && integral && (integer & 1);
+	if (FIXMATH_UNLIKELY(a.raw() < 0 && !integral)) {
+		FIXMATH_ERROR("pow(<0, non-integer)");
+		if constexpr (policy::saturation_mode) {
+			return fixed::min_sat();
+		} else {
+			return fixed::nan();
+		}
+	}
+	const uint64_t magnitude = static_cast<uint64_t>(_fm_absraw(a.raw()));
+	const int shift = ::std::countl_zero(magnitude);
+	const int64_t logarithm = (int64_t{63} - shift - fixed::FRACTION_BITS) * (int64_t{1} << 56) + static_cast<int64_t>(_fm_log2_q64(magnitude << shift) >> 8);
+	// b log2(a) in units of 2^-(56 + F)
+	int64_t product_hi = 0;
+	const uint64_t product_lo = static_cast<uint64_t>(_fm_mul128(logarithm, static_cast<int64_t>(b.raw()), product_hi));
+	constexpr int SCALE = 56 + fixed::FRACTION_BITS;
+	int64_t integer_part = 0;
+	uint64_t fraction = 0;
+	bool beyond = false;
+	if constexpr (SCALE < 64) {
+		// the integer part is the 128-bit value (product_hi >> SCALE, integer_part)
+		integer_part = static_cast<int64_t>((product_lo >> SCALE) | (static_cast<uint64_t>(product_hi) << (64 - SCALE)));
+		beyond = (product_hi >> SCALE) != (integer_part >> 63);
+		fraction = product_lo << (64 - SCALE);
+	} else if constexpr (SCALE == 64) {
+		integer_part = product_hi;
+		fraction = product_lo;
+	} else {
+		integer_part = product_hi >> (SCALE - 64);
+		fraction = (static_cast<uint64_t>(product_hi) << (128 - SCALE)) | (product_lo >> (SCALE - 64));
+	}
+	if (FIXMATH_UNLIKELY(beyond || integer_part > 64 || integer_part < -64)) {
+		// 2^64 is beyond every raw and 2^-64 rounds to zero for F <= 56
+		integer_part = product_hi < 0 ? -64 : 64;
+		fraction = 0;
+	}
+	return _fm_round_mantissa<policy>(_fm_exp2_q63(fraction), 0, integer_part - 127 + fixed::FRACTION_BITS, true, negative);
+}
+
 } // namespace fixmath
@@ -0,0 +1,75 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <span>   // for std::span
+#include <vector> // for std::vector
+#include "fixed.hpp"
+#include "fixmath_cpu.inl"
+#include "fixmath_thread.inl"
+
+namespace fixmath::parallel {
+
+struct options {
+	// 0 selects std::thread::hardware_concurrency().
+	unsigned thread_count = 0;
+	// Elements per task. Results do not depend on it or on thread_count.
+	::std::size_t grain = ::std::size_t{1} << 16;
+};
+
+template <FixedPolicy policy>
+struct reduction {
+	fixed<policy> value;
+	// The exact result is outside [min_fix, max_fix]. value is then wrapped in Ignore mode,
+	// and max_sat or min_sat otherwise.
+	bool overflow = false;
+	// reduce only: a partial sum in index order left [min_fix, max_fix], so a serial
+	// operator+ loop would have saturated and may disagree with value. Always false in
+	// Ignore mode, where wrapping addition is associative.
+	bool partial_overflow = false;
+};
+
+// Exact sum of all values, computed with a wide accumulator and narrowed once.
+template <FixedPolicy policy>
+reduction<policy> reduce(::std::span<const fixed<policy>> values, const options& opts = {});
+
+// Exact sum of full-width products a[i] * b[i], rounded once to the policy's format.
+template <FixedPolicy policy>
+reduction<policy> dot(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, const options& opts = {});
+
+// out[i] = a[i] * b[i], with exactly the values of operator*. All three spans must have the
+// same length, and out may be the same span as a or b.
+template <FixedPolicy policy>
+void multiply(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts = {});
+
+// out[i] = a[i] / b[i], with exactly the values of operator/. Same span rules as multiply.
+template <FixedPolicy policy>
+void divide(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts = {});
+
+// out[i] = a[i] + b[i], with exactly the values of operator+. Same span rules as multiply.
+template <FixedPolicy policy>
+void add(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts = {});
+
+// Smallest and largest element; nan if any element is nan. values must not be empty.
+template <FixedPolicy policy>
+fixed<policy> min(::std::span<const fixed<policy>> values, const options& opts = {});
+
+template <FixedPolicy policy>
+fixed<policy> max(::std::span<const fixed<policy>> values, const options& opts = {});
+
+// Inclusive and exclusive prefix sums with exactly the values of the serial loops
+//   acc = 0;    for (i) { acc = acc + in[i]; out[i] = acc; }
+//   acc = init; for (i) { out[i] = acc; acc = acc + in[i]; }
+// Returns the index of the first element whose addition overflowed the finite range, or
+// in.size() if none did; always in.size() in Ignore mode. out must have in.size() elements and may be the same span as in.
+template <FixedPolicy policy>
+::std::size_t inclusive_scan(::std::span<const fixed<policy>> in, ::std::span<fixed<policy>> out, const options& opts = {});
+
+template <FixedPolicy policy>
+::std::size_t exclusive_scan(::std::span<const fixed<policy>> in, ::std::span<fixed<policy>> out, fixed<policy> init = {}, const options& opts = {});
+
+} // namespace fixmath::parallel
+
+#include "fixed_parallel.inl"
@@ -0,0 +1,892 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Exact partial result of one task. high and low are the extreme partial sums inside the
+// task, relative to its start; they decide whether a serial loop would have saturated.
+struct _fm_reduce_part {
+	_fm_int192 sum = {};
+	_fm_int192 high = {};
+	_fm_int192 low = {};
+	bool nan = false;
+	bool positive_inf = false;
+	bool negative_inf = false;
+};
+
+// Record a strict-mode special value. Returns true when raw is not a finite value.
+template <FixedPolicy policy>
+inline bool _fm_reduce_special(typename policy::raw_t raw, _fm_reduce_part& part) {
+	using fixed = fixed<policy>;
+	if constexpr (policy::strict_mode) {
+		if (FIXMATH_UNLIKELY(raw == fixed::nan().raw())) {
+			part.nan = true;
+			return true;
+		}
+		if (FIXMATH_UNLIKELY(raw == fixed::inf().raw())) {
+			part.positive_inf = true;
+			return true;
+		}
+		if (FIXMATH_UNLIKELY(raw == (-fixed::inf()).raw())) {
+			part.negative_inf = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+template <FixedPolicy policy>
+_fm_reduce_part _fm_reduce_sum(const fixed<policy>* values, ::std::size_t count) {
+	using raw_t = typename policy::raw_t;
+	_fm_reduce_part part;
+	if constexpr (sizeof(raw_t) < sizeof(int64_t)) {
+		// int64_t holds any sum of 2^31 raws of up to 32 bits. grain and thread_count do not
+		// bound the task size, so longer tasks are summed in blocks of that many elements.
+		constexpr ::std::size_t BLOCK = ::std::size_t{1} << 31;
+		::std::size_t first = 0;
+		while (first < count) {
+			const ::std::size_t last = first + ::std::min(BLOCK, count - first);
+			int64_t sum = 0;
+			int64_t high = 0;
+			int64_t low = 0;
+			for (::std::size_t i = first; i < last; ++i) {
+				const raw_t raw = values[i].raw();
+				if (_fm_reduce_special<policy>(raw, part)) {
+					continue;
+				}
+				sum += raw;
+				if constexpr (!policy::ignore_mode) {
+					high = sum > high ? sum : high;
+					low = sum < low ? sum : low;
+				}
+			}
+			// the block's extreme partial sums, relative to the task start
+			_fm_int192 block_high = part.sum;
+			_fm_add(block_high, _fm_make_int192(high));
+			_fm_int192 block_low = part.sum;
+			_fm_add(block_low, _fm_make_int192(low));
+			if (_fm_less(part.high, block_high)) {
+				part.high = block_high;
+			}
+			if (_fm_less(block_low, part.low)) {
+				part.low = block_low;
+			}
+			_fm_add(part.sum, _fm_make_int192(sum));
+			first = last;
+		}
+	} else {
+		int64_t hi = 0;
+		int64_t lo = 0;
+		int64_t high_hi = 0;
+		int64_t high_lo = 0;
+		int64_t low_hi = 0;
+		int64_t low_lo = 0;
+		for (::std::size_t i = 0; i < count; ++i) {
+			const raw_t raw = values[i].raw();
+			if (_fm_reduce_special<policy>(raw, part)) {
+				continue;
+			}
+			_fm_add128(hi, lo, raw);
+			if constexpr (!policy::ignore_mode) {
+				if (hi > high_hi || (hi == high_hi && static_cast<uint64_t>(lo) > static_cast<uint64_t>(high_lo))) {
+					high_hi = hi;
+					high_lo = lo;
+				}
+				if (hi < low_hi || (hi == low_hi && static_cast<uint64_t>(lo) < static_cast<uint64_t>(low_lo))) {
+					low_hi = hi;
+					low_lo = lo;
+				}
+			}
+		}
+		part.sum = _fm_make_int192(hi, static_cast<uint64_t>(lo));
+		part.high = _fm_make_int192(high_hi, static_cast<uint64_t>(high_lo));
+		part.low = _fm_make_int192(low_hi, static_cast<uint64_t>(low_lo));
+	}
+	return part;
+}
+
+template <FixedPolicy policy>
+_fm_reduce_part _fm_reduce_dot(const fixed<policy>* a, const fixed<policy>* b, ::std::size_t count) {
+	using raw_t = typename policy::raw_t;
+	_fm_reduce_part part;
+	// For 64-bit raws, (hi, lo) sums the high product words and low sums the low words, counting
+	// its carries. The two chains are independent, unlike a 192-bit add per product.
+	int64_t hi = 0;
+	int64_t lo = 0;
+	uint64_t low = 0;
+	uint64_t low_carries = 0;
+	for (::std::size_t i = 0; i < count; ++i) {
+		if constexpr (policy::strict_mode) {
+			if (FIXMATH_UNLIKELY(a[i].is_nan() || a[i].is_inf() || b[i].is_nan() || b[i].is_inf())) {
+				_fm_reduce_special<policy>((a[i] * b[i]).raw(), part);
+				continue;
+			}
+		}
+		if constexpr (sizeof(raw_t) < sizeof(int64_t)) {
+			_fm_add128(hi, lo, int64_t{a[i].raw()} * b[i].raw());
+		} else {
+			int64_t product_hi = 0;
+			const uint64_t product_lo = static_cast<uint64_t>(_fm_mul128(a[i].raw(), b[i].raw(), product_hi));
+			low += product_lo;
+			low_carries += low < product_lo;
+			_fm_add128(hi, lo, product_hi);
+		}
+	}
+	if constexpr (sizeof(raw_t) < sizeof(int64_t)) {
+		part.sum = _fm_make_int192(hi, static_cast<uint64_t>(lo));
+	} else {
+		_fm_add128(hi, lo, static_cast<int64_t>(low_carries));
+		part.sum = {{low, static_cast<uint64_t>(lo), static_cast<uint64_t>(hi)}};
+	}
+	return part;
+}
+
+// Combine task results in index order and narrow the exact total by shift bits.
+template <FixedPolicy policy>
+parallel::reduction<policy> _fm_reduce_finish(const ::std::vector<_fm_reduce_part>& parts, int shift) {
+	using fixed = fixed<policy>;
+	parallel::reduction<policy> result;
+	_fm_int192 total = {};
+	bool nan = false;
+	bool positive_inf = false;
+	bool negative_inf = false;
+	const _fm_int192 upper = _fm_make_int192(fixed::max_fix().raw());
+	const _fm_int192 lower = _fm_make_int192(fixed::min_fix().raw());
+	for (const _fm_reduce_part& part : parts) {
+		if constexpr (!policy::ignore_mode) {
+			_fm_int192 high = total;
+			_fm_int192 low = total;
+			_fm_add(high, part.high);
+			_fm_add(low, part.low);
+			result.partial_overflow = result.partial_overflow || _fm_less(upper, high) || _fm_less(low, lower);
+		}
+		_fm_add(total, part.sum);
+		nan = nan || part.nan;
+		positive_inf = positive_inf || part.positive_inf;
+		negative_inf = negative_inf || part.negative_inf;
+	}
+	if constexpr (policy::strict_mode) {
+		if (nan || (positive_inf && negative_inf)) {
+			result.value = fixed::nan();
+			return result;
+		}
+		if (positive_inf || negative_inf) {
+			result.value = positive_inf ? fixed::inf() : -fixed::inf();
+			return result;
+		}
+	}
+	result.value = fixed::from_raw(_fm_narrow192<policy>(total, shift, result.overflow));
+	return result;
+}
+
+inline ::std::size_t _fm_task_count(::std::size_t count, ::std::size_t grain) {
+	return grain == 0 ? count : (count + grain - 1) / grain;
+}
+
+// Smallest or largest raw of values[0, count), and whether any is the strict nan pattern.
+template <FixedPolicy policy, bool largest>
+typename policy::raw_t _fm_extreme_block(const fixed<policy>* values, ::std::size_t count, bool& nan) {
+	using fixed = fixed<policy>;
+	using raw_t = typename policy::raw_t;
+	raw_t best = values[0].raw();
+	for (::std::size_t i = 0; i < count; ++i) {
+		const raw_t raw = values[i].raw();
+		if constexpr (policy::strict_mode) {
+			nan = nan || raw == fixed::nan().raw();
+		}
+		best = (largest ? raw > best : raw < best) ? raw : best;
+	}
+	return best;
+}
+
+// 16- and 32-bit raws whose operator+ and operator* reduce to saturating or wrapping integer
+// lane operations. Strict mode keeps the scalar path for its special values.
+template <FixedPolicy policy>
+constexpr bool _fm_narrow_simd = (sizeof(typename policy::raw_t) == sizeof(int16_t) || sizeof(typename policy::raw_t) == sizeof(int32_t)) && !policy::strict_mode;
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+#	if defined(__GNUC__) && !defined(__clang__)
+// GCC 12 warns about the deliberately undefined vectors inside its own AVX-512 intrinsics.
+#		pragma GCC diagnostic push
+#		pragma GCC diagnostic ignored "-Wuninitialized"
+#		pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	endif
+template <bool WIDE, bool largest, bool strict>
+FIXMATH_TARGET("avx512f") inline void _fm_extreme_step_avx512(__m512i& best, unsigned& nan_lanes, __m512i v, __m512i nan_pattern) {
+	if constexpr (WIDE) {
+		best = largest ? _mm512_max_epi64(best, v) : _mm512_min_epi64(best, v);
+		if constexpr (strict) {
+			nan_lanes |= _mm512_cmpeq_epi64_mask(v, nan_pattern);
+		}
+	} else {
+		best = largest ? _mm512_max_epi32(best, v) : _mm512_min_epi32(best, v);
+		if constexpr (strict) {
+			nan_lanes |= _mm512_cmpeq_epi32_mask(v, nan_pattern);
+		}
+	}
+}
+
+// _fm_extreme_block for 32- and 64-bit raws on 512-bit vectors. Requires _fm_cpu().avx512f.
+template <FixedPolicy policy, bool largest>
+FIXMATH_TARGET("avx512f") typename policy::raw_t _fm_extreme_block_avx512(const fixed<policy>* values, ::std::size_t count, bool& nan) {
+	using fixed = fixed<policy>;
+	using raw_t = typename policy::raw_t;
+	static_assert(sizeof(raw_t) == sizeof(int32_t) || sizeof(raw_t) == sizeof(int64_t));
+	static_assert(sizeof(fixed) == sizeof(raw_t));
+	constexpr ::std::size_t LANES = 64 / sizeof(raw_t);
+	constexpr bool WIDE = sizeof(raw_t) == sizeof(int64_t);
+	if (count < LANES) {
+		return _fm_extreme_block<policy, largest>(values, count, nan);
+	}
+	const __m512i nan_pattern = WIDE ? _mm512_set1_epi64(static_cast<int64_t>(fixed::nan().raw())) : _mm512_set1_epi32(static_cast<int32_t>(fixed::nan().raw()));
+	__m512i best = _mm512_loadu_si512(values);
+	unsigned nan_lanes = 0;
+	::std::size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		_fm_extreme_step_avx512<WIDE, largest, policy::strict_mode>(best, nan_lanes, _mm512_loadu_si512(values + i), nan_pattern);
+	}
+	// The last vector may overlap the previous one; min, max, and the nan test do not mind.
+	if (i < count) {
+		_fm_extreme_step_avx512<WIDE, largest, policy::strict_mode>(best, nan_lanes, _mm512_loadu_si512(values + count - LANES), nan_pattern);
+	}
+	nan = nan || nan_lanes != 0;
+	if constexpr (WIDE) {
+		return static_cast<raw_t>(largest ? _mm512_reduce_max_epi64(best) : _mm512_reduce_min_epi64(best));
+	} else {
+		return static_cast<raw_t>(largest ? _mm512_reduce_max_epi32(best) : _mm512_reduce_min_epi32(best));
+	}
+}
+
+// Eight lanes of _fm_mul128 followed by _fm_div2n_round<policy, F>, for 64-bit raws. Returns
+// the low word of each rounded product and flags the lanes whose product does not fit raw_t.
+// The magnitudes are split into 52-bit limbs, the operand width of vpmadd52luq/vpmadd52huq.
+// Both roundings are symmetric, so rounding the magnitude and then negating it matches the
+// signed scalar result. Requires _fm_cpu().avx512ifma.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx512f,avx512ifma") inline __m512i _fm_mul_round_avx512ifma(__m512i a, __m512i b, __mmask8& overflow) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	static_assert(sizeof(typename policy::raw_t) == sizeof(int64_t));
+	static_assert(0 < F && F < 64);
+	const __m512i zero = _mm512_setzero_si512();
+	const __m512i one = _mm512_set1_epi64(1);
+	const __m512i limb = _mm512_set1_epi64((int64_t{1} << 52) - 1);
+	const __mmask8 negative = _mm512_cmplt_epi64_mask(_mm512_xor_si512(a, b), zero);
+	const __m512i ua = _mm512_abs_epi64(a);
+	const __m512i ub = _mm512_abs_epi64(b);
+	const __m512i a0 = _mm512_and_si512(ua, limb);
+	const __m512i a1 = _mm512_srli_epi64(ua, 52);
+	const __m512i b0 = _mm512_and_si512(ub, limb);
+	const __m512i b1 = _mm512_srli_epi64(ub, 52);
+	// P = c0 + c1 * 2^52 + c2 * 2^104 with c0 < 2^52 and c1 < 3 * 2^52; a1 * b1 < 2^24 has no high part.
+	const __m512i c0 = _mm512_madd52lo_epu64(zero, a0, b0);
+	__m512i c1 = _mm512_madd52hi_epu64(zero, a0, b0);
+	c1 = _mm512_madd52lo_epu64(c1, a0, b1);
+	c1 = _mm512_madd52lo_epu64(c1, a1, b0);
+	__m512i c2 = _mm512_madd52hi_epu64(zero, a0, b1);
+	c2 = _mm512_madd52hi_epu64(c2, a1, b0);
+	c2 = _mm512_madd52lo_epu64(c2, a1, b1);
+	const __m512i low = _mm512_or_si512(c0, _mm512_slli_epi64(c1, 52));
+	const __m512i high = _mm512_add_epi64(_mm512_srli_epi64(c1, 12), _mm512_slli_epi64(c2, 40));
+
+	__m512i magnitude = _mm512_or_si512(_mm512_srli_epi64(low, F), _mm512_slli_epi64(high, 64 - F));
+	__m512i magnitude_high = _mm512_srli_epi64(high, F);
+	if constexpr (policy::rounding) {
+		const __m512i half = _mm512_set1_epi64(int64_t{1} << (F - 1));
+		const __m512i fraction = _mm512_and_si512(low, _mm512_set1_epi64(static_cast<int64_t>((uint64_t{1} << F) - 1)));
+		const __mmask8 up = _mm512_cmpgt_epu64_mask(fraction, half) | (_mm512_cmpeq_epi64_mask(fraction, half) & _mm512_test_epi64_mask(magnitude, one));
+		magnitude = _mm512_mask_add_epi64(magnitude, up, magnitude, one);
+		magnitude_high = _mm512_mask_add_epi64(magnitude_high, up & _mm512_cmpeq_epi64_mask(magnitude, zero), magnitude_high, one);
+	}
+	// Positive results must stay below 2^63, negative ones may reach it.
+	const __m512i limit = _mm512_set1_epi64(::std::numeric_limits<int64_t>::max());
+	overflow = _mm512_cmpneq_epi64_mask(magnitude_high, zero) | _mm512_mask_cmpgt_epu64_mask(static_cast<__mmask8>(~negative), magnitude, limit) |
+	           _mm512_mask_cmpgt_epu64_mask(negative, magnitude, _mm512_add_epi64(limit, one));
+	return _mm512_mask_sub_epi64(magnitude, negative, zero, magnitude);
+}
+
+// out[i] = a[i] * b[i] for count elements. Lanes that operator* treats specially, namely
+// strict special values and products outside the finite range, are redone by operator*.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx512f,avx512ifma") void _fm_multiply_block_avx512ifma(const fixed<policy>* a, const fixed<policy>* b, fixed<policy>* out, ::std::size_t count) {
+	using fixed = fixed<policy>;
+	static_assert(sizeof(fixed) == sizeof(int64_t));
+	const __m512i inf = _mm512_set1_epi64(fixed::inf().raw());
+	const __m512i nan = _mm512_set1_epi64(fixed::nan().raw());
+	const __m512i negative_inf = _mm512_set1_epi64((-fixed::inf()).raw());
+	::std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m512i x = _mm512_loadu_si512(a + i);
+		const __m512i y = _mm512_loadu_si512(b + i);
+		__mmask8 overflow = 0;
+		const __m512i r = _fm_mul_round_avx512ifma<policy>(x, y, overflow);
+		__mmask8 scalar = 0;
+		if constexpr (!policy::ignore_mode) {
+			scalar = overflow;
+		}
+		if constexpr (policy::strict_mode) {
+			scalar |= _mm512_cmpeq_epi64_mask(x, inf) | _mm512_cmpeq_epi64_mask(x, nan) | _mm512_cmpeq_epi64_mask(x, negative_inf);
+			scalar |= _mm512_cmpeq_epi64_mask(y, inf) | _mm512_cmpeq_epi64_mask(y, nan) | _mm512_cmpeq_epi64_mask(y, negative_inf);
+			scalar |= _mm512_cmpeq_epi64_mask(r, nan);
+		}
+		if (FIXMATH_UNLIKELY(scalar != 0)) {
+			for (::std::size_t j = i; j < i + 8; ++j) {
+				out[j] = a[j] * b[j];
+			}
+			continue;
+		}
+		_mm512_storeu_si512(out + i, r);
+	}
+	for (; i < count; ++i) {
+		out[i] = a[i] * b[i];
+	}
+}
+
+// Rounded 32-bit product lanes, q = round(p / 2^F) for the exact 32-bit products p of
+// 16-bit raws.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m256i _fm_div2n_round_avx2(__m256i p) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i fraction = _mm256_and_si256(p, _mm256_set1_epi32((1 << F) - 1));
+	const __m256i q = _mm256_srai_epi32(p, F);
+	__m256i up;
+	if constexpr (policy::rounding) {
+		const __m256i half = _mm256_set1_epi32(1 << (F - 1));
+		const __m256i odd = _mm256_and_si256(q, _mm256_set1_epi32(1));
+		up = _mm256_or_si256(_mm256_cmpgt_epi32(fraction, half), _mm256_and_si256(_mm256_cmpeq_epi32(fraction, half), _mm256_cmpgt_epi32(odd, zero)));
+	} else {
+		// floor to truncation: negative products with a fraction move up by one
+		up = _mm256_andnot_si256(_mm256_cmpeq_epi32(fraction, zero), _mm256_cmpgt_epi32(zero, p));
+	}
+	return _mm256_sub_epi32(q, up);
+}
+
+// Sixteen lanes of operator* for 16-bit raws in SaturationMode or Ignore. Q1.15 with
+// round-to-even uses vpmulhrsw, which rounds ties up; the discarded bits from vpmullw find
+// the ties so the odd ones can be taken back. Other formats widen the products to 32 bits.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m256i _fm_mul16_avx2(__m256i a, __m256i b) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	static_assert(sizeof(typename policy::raw_t) == sizeof(int16_t) && !policy::strict_mode);
+	const __m256i low = _mm256_mullo_epi16(a, b);
+	if constexpr (F == 15 && policy::rounding) {
+		const __m256i one = _mm256_set1_epi16(1);
+		__m256i r = _mm256_mulhrs_epi16(a, b);
+		const __m256i tie = _mm256_cmpeq_epi16(_mm256_and_si256(low, _mm256_set1_epi16(0x7fff)), _mm256_set1_epi16(0x4000));
+		r = _mm256_add_epi16(r, _mm256_and_si256(tie, _mm256_cmpeq_epi16(_mm256_and_si256(r, one), one)));
+		if constexpr (!policy::ignore_mode) {
+			// only -1.0 * -1.0 wraps to INT16_MIN
+			r = _mm256_xor_si256(r, _mm256_cmpeq_epi16(r, _mm256_set1_epi16(::std::numeric_limits<int16_t>::min())));
+		}
+		return r;
+	} else {
+		const __m256i high = _mm256_mulhi_epi16(a, b);
+		const __m256i q0 = _fm_div2n_round_avx2<policy>(_mm256_unpacklo_epi16(low, high));
+		const __m256i q1 = _fm_div2n_round_avx2<policy>(_mm256_unpackhi_epi16(low, high));
+		if constexpr (policy::ignore_mode) {
+			const __m256i mask = _mm256_set1_epi32(0xffff);
+			return _mm256_packus_epi32(_mm256_and_si256(q0, mask), _mm256_and_si256(q1, mask));
+		} else {
+			return _mm256_packs_epi32(q0, q1);
+		}
+	}
+}
+
+// Eight lanes of round(v / 2^F) for 32-bit raws in SaturationMode or Ignore, where the 64-bit
+// values v are given as their low and high words. The words are shifted and rounded as a
+// pair, then saturated or wrapped like operator*.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m256i _fm_round64_avx2(__m256i low, __m256i high) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	static_assert(sizeof(typename policy::raw_t) == sizeof(int32_t) && !policy::strict_mode);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i fraction = _mm256_and_si256(low, _mm256_set1_epi32(static_cast<int32_t>((uint32_t{1} << F) - 1)));
+	__m256i q = _mm256_or_si256(_mm256_srli_epi32(low, F), _mm256_slli_epi32(high, 32 - F));
+	__m256i q_high = _mm256_srai_epi32(high, F);
+	__m256i up;
+	if constexpr (policy::rounding) {
+		const __m256i half = _mm256_set1_epi32(static_cast<int32_t>(uint32_t{1} << (F - 1)));
+		const __m256i odd_q = _mm256_and_si256(q, _mm256_set1_epi32(1));
+		up = _mm256_or_si256(_mm256_cmpgt_epi32(fraction, half), _mm256_and_si256(_mm256_cmpeq_epi32(fraction, half), _mm256_cmpgt_epi32(odd_q, zero)));
+	} else {
+		up = _mm256_andnot_si256(_mm256_cmpeq_epi32(fraction, zero), _mm256_cmpgt_epi32(zero, high));
+	}
+	q = _mm256_sub_epi32(q, up);
+	q_high = _mm256_sub_epi32(q_high, _mm256_and_si256(up, _mm256_cmpeq_epi32(q, zero)));
+	if constexpr (!policy::ignore_mode) {
+		const __m256i fits = _mm256_cmpeq_epi32(q_high, _mm256_srai_epi32(q, 31));
+		const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(q_high, 31), _mm256_set1_epi32(::std::numeric_limits<int32_t>::max()));
+		q = _mm256_blendv_epi8(saturated, q, fits);
+	}
+	return q;
+}
+
+// Round 64-bit values for the even and odd 32-bit positions into one vector.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m256i _fm_round64_pair_avx2(__m256i even, __m256i odd) {
+	return _fm_round64_avx2<policy>(_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa), _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa));
+}
+
+// a + b on 64-bit lanes; lanes whose sum leaves int64_t set the sign bit of overflow.
+FIXMATH_TARGET("avx2") inline __m256i _fm_add_epi64_avx2(__m256i a, __m256i b, __m256i& overflow) {
+	const __m256i sum = _mm256_add_epi64(a, b);
+	overflow = _mm256_or_si256(overflow, _mm256_and_si256(_mm256_xor_si256(sum, a), _mm256_xor_si256(sum, b)));
+	return sum;
+}
+
+// Eight lanes of operator* for 32-bit raws in SaturationMode or Ignore.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m256i _fm_mul32_avx2(__m256i a, __m256i b) {
+	const __m256i even = _mm256_mul_epi32(a, b);
+	const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+	return _fm_round64_pair_avx2<policy>(even, odd);
+}
+
+// out[i] = a[i] * b[i] for count elements of a 16- or 32-bit raw policy without special
+// values. Requires _fm_cpu().avx2.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") void _fm_multiply_block_avx2(const fixed<policy>* a, const fixed<policy>* b, fixed<policy>* out, ::std::size_t count) {
+	constexpr ::std::size_t LANES = 32 / sizeof(fixed<policy>);
+	::std::size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+		const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+		if constexpr (sizeof(fixed<policy>) == sizeof(int16_t)) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _fm_mul16_avx2<policy>(x, y));
+		} else {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _fm_mul32_avx2<policy>(x, y));
+		}
+	}
+	for (; i < count; ++i) {
+		out[i] = a[i] * b[i];
+	}
+}
+
+// out[i] = a[i] + b[i] for count elements of a 16- or 32-bit raw policy without special
+// values. 16-bit saturation is vpaddsw; 32-bit saturation has no instruction and selects
+// the limit by the sign of a in the lanes whose sign overflowed. Requires _fm_cpu().avx2.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") void _fm_add_block_avx2(const fixed<policy>* a, const fixed<policy>* b, fixed<policy>* out, ::std::size_t count) {
+	constexpr ::std::size_t LANES = 32 / sizeof(fixed<policy>);
+	static_assert(!policy::strict_mode);
+	::std::size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+		const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+		__m256i r;
+		if constexpr (sizeof(fixed<policy>) == sizeof(int16_t)) {
+			r = policy::ignore_mode ? _mm256_add_epi16(x, y) : _mm256_adds_epi16(x, y);
+			if constexpr (!policy::ignore_mode) {
+				// operator+ picks the limit from the wrapped sum, which is 0 for min + min
+				const __m256i min = _mm256_set1_epi16(::std::numeric_limits<int16_t>::min());
+				r = _mm256_xor_si256(r, _mm256_and_si256(_mm256_cmpeq_epi16(x, min), _mm256_cmpeq_epi16(y, min)));
+			}
+		} else {
+			r = _mm256_add_epi32(x, y);
+			if constexpr (!policy::ignore_mode) {
+				const __m256i min = _mm256_set1_epi32(::std::numeric_limits<int32_t>::min());
+				const __m256i overflow = _mm256_andnot_si256(_mm256_xor_si256(x, y), _mm256_xor_si256(x, r));
+				const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(x, 31), _mm256_set1_epi32(::std::numeric_limits<int32_t>::max()));
+				r = _mm256_blendv_epi8(r, saturated, _mm256_srai_epi32(overflow, 31));
+				// operator+ picks the limit from the wrapped sum, which is 0 for min + min
+				r = _mm256_xor_si256(r, _mm256_and_si256(_mm256_cmpeq_epi32(x, min), _mm256_cmpeq_epi32(y, min)));
+			}
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+	}
+	for (; i < count; ++i) {
+		out[i] = a[i] + b[i];
+	}
+}
+
+// Quotient estimates for four lanes of 32-bit magnitudes, never above floor((n << F) / d) and
+// at most one below it. The vrcpps seed is good to 12 bits, and two Newton steps in double
+// precision take it past the 32 bits a quotient below 2^31 needs. The bias keeps the estimate
+// below the true quotient, so a single upward correction is enough. Lanes whose quotient may
+// reach 2^31, and lanes with a zero divisor, where the estimate is nan, clear ok.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") inline __m128i _fm_div32_estimate_avx2(__m128i abs_a, __m128i abs_b, __m128 seed, __m256d& ok) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	const __m256d sign = _mm256_set1_pd(-0.0);
+	const __m256d one = _mm256_set1_pd(1.0);
+	// abs_epi32 leaves INT32_MIN negative; clearing the sign of the double fixes 2^31 exactly
+	const __m256d d = _mm256_andnot_pd(sign, _mm256_cvtepi32_pd(abs_b));
+	const __m256d n = _mm256_mul_pd(_mm256_andnot_pd(sign, _mm256_cvtepi32_pd(abs_a)), _mm256_set1_pd(static_cast<double>(uint32_t{1} << F)));
+	__m256d y = _mm256_cvtps_pd(seed);
+	y = _mm256_add_pd(y, _mm256_mul_pd(y, _mm256_sub_pd(one, _mm256_mul_pd(d, y))));
+	y = _mm256_add_pd(y, _mm256_mul_pd(y, _mm256_sub_pd(one, _mm256_mul_pd(d, y))));
+	const __m256d q = _mm256_sub_pd(_mm256_mul_pd(n, y), _mm256_set1_pd(1.0 / 8192));
+	ok = _mm256_cmp_pd(q, _mm256_set1_pd(2147483520.0), _CMP_LT_OQ);
+	return _mm256_cvttpd_epi32(q);
+}
+
+// Unsigned a >= b per 32-bit lane.
+FIXMATH_TARGET("avx2") inline __m256i _fm_cmpge_epu32_avx2(__m256i a, __m256i b) {
+	return _mm256_cmpeq_epi32(_mm256_max_epu32(a, b), a);
+}
+
+// out[i] = a[i] / b[i] for count elements of a 32-bit raw policy without special values.
+// The quotient magnitude is estimated from a floating-point reciprocal and made exact with
+// the remainder, which is below 2 * |b| <= 2^32, so its low 32 bits from vpmulld suffice.
+// Blocks with a zero divisor or a quotient that may leave the int32 range are recomputed
+// with operator/. Requires _fm_cpu().avx2.
+template <FixedPolicy policy>
+FIXMATH_TARGET("avx2") void _fm_divide_block_avx2(const fixed<policy>* a, const fixed<policy>* b, fixed<policy>* out, ::std::size_t count) {
+	constexpr int F = static_cast<int>(fixed<policy>::FRACTION_BITS);
+	static_assert(sizeof(typename policy::raw_t) == sizeof(int32_t) && !policy::strict_mode);
+	const __m256i ones = _mm256_set1_epi32(-1);
+	::std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+		const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+		const __m256i abs_x = _mm256_abs_epi32(x);
+		const __m256i abs_y = _mm256_abs_epi32(y);
+		const __m256 seed = _mm256_rcp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_cvtepi32_ps(abs_y)));
+		__m256d ok_low;
+		__m256d ok_high;
+		const __m128i q_low = _fm_div32_estimate_avx2<policy>(_mm256_castsi256_si128(abs_x), _mm256_castsi256_si128(abs_y), _mm256_castps256_ps128(seed), ok_low);
+		const __m128i q_high = _fm_div32_estimate_avx2<policy>(_mm256_extracti128_si256(abs_x, 1), _mm256_extracti128_si256(abs_y, 1), _mm256_extractf128_ps(seed, 1), ok_high);
+		if (FIXMATH_UNLIKELY(_mm256_movemask_pd(_mm256_and_pd(ok_low, ok_high)) != 0xf)) {
+			for (::std::size_t j = i; j < i + 8; ++j) {
+				out[j] = a[j] / b[j];
+			}
+			continue;
+		}
+		__m256i q = _mm256_inserti128_si256(_mm256_castsi128_si256(q_low), q_high, 1);
+		__m256i r = _mm256_sub_epi32(_mm256_slli_epi32(abs_x, F), _mm256_mullo_epi32(q, abs_y));
+		const __m256i low = _fm_cmpge_epu32_avx2(r, abs_y);
+		q = _mm256_sub_epi32(q, low);
+		if constexpr (policy::rounding) {
+			r = _mm256_sub_epi32(r, _mm256_and_si256(abs_y, low));
+			// round up when 2r > |b|, or 2r == |b| and q is odd: 2r + (q & 1) > |b|
+			const __m256i odd = _mm256_and_si256(q, _mm256_set1_epi32(1));
+			const __m256i twice = _mm256_add_epi32(_mm256_slli_epi32(r, 1), odd);
+			q = _mm256_sub_epi32(q, _mm256_xor_si256(_fm_cmpge_epu32_avx2(abs_y, twice), ones));
+		}
+		const __m256i negate = _mm256_srai_epi32(_mm256_xor_si256(x, y), 31);
+		q = _mm256_sub_epi32(_mm256_xor_si256(q, negate), negate);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), q);
+	}
+	for (; i < count; ++i) {
+		out[i] = a[i] / b[i];
+	}
+}
+#	if defined(__GNUC__) && !defined(__clang__)
+#		pragma GCC diagnostic pop
+#	endif
+#endif
+
+template <FixedPolicy policy, bool largest>
+fixed<policy> _fm_reduce_extreme(::std::span<const fixed<policy>> values, const parallel::options& opts) {
+	using fixed = fixed<policy>;
+	using raw_t = typename policy::raw_t;
+	FIXMATH_ASSERT(!values.empty(), "min/max of an empty span");
+	if (values.empty()) {
+		return fixed{};
+	}
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	::std::vector<raw_t> parts(_fm_task_count(values.size(), grain));
+	_fm_parallel_for(parts.size(), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t size = ::std::min(grain, values.size() - first);
+		bool nan = false;
+		raw_t best = 0;
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(raw_t) == sizeof(int32_t) || sizeof(raw_t) == sizeof(int64_t)) {
+			if (_fm_cpu().avx512f) {
+				best = _fm_extreme_block_avx512<policy, largest>(values.data() + first, size, nan);
+				parts[task] = nan ? fixed::nan().raw() : best;
+				return;
+			}
+		}
+#endif
+		best = _fm_extreme_block<policy, largest>(values.data() + first, size, nan);
+		parts[task] = nan ? fixed::nan().raw() : best;
+	});
+	raw_t best = parts[0];
+	for (const raw_t part : parts) {
+		if constexpr (policy::strict_mode) {
+			if (part == fixed::nan().raw() || best == fixed::nan().raw()) {
+				best = fixed::nan().raw();
+				continue;
+			}
+		}
+		best = (largest ? part > best : part < best) ? part : best;
+	}
+	return fixed::from_raw(best);
+}
+
+// Event word for adding x to prev, giving the wrapped r. Its sign bit is set when the step may
+// leave the wrapping fast path: a signed overflow, or in StrictMode a reserved nan/inf pattern
+// on any side. Words are OR-ed over a block so that the loop itself stays branch-free.
+template <FixedPolicy policy>
+constexpr typename fixed<policy>::uraw_t _fm_scan_event(typename fixed<policy>::uraw_t prev, typename fixed<policy>::uraw_t x, typename fixed<policy>::uraw_t r) {
+	using fixed = fixed<policy>;
+	using uraw_t = typename fixed::uraw_t;
+	if constexpr (policy::ignore_mode) {
+		return 0;
+	} else {
+		uraw_t event = static_cast<uraw_t>((prev ^ r) & (x ^ r));
+		if constexpr (policy::strict_mode) {
+			// inf, nan and -inf are the three consecutive patterns starting at inf.
+			const uraw_t reserved = fixed::inf().uraw();
+			const bool special = static_cast<uraw_t>(prev - reserved) <= 2 || static_cast<uraw_t>(x - reserved) <= 2 || static_cast<uraw_t>(r - reserved) <= 2;
+			event |= special ? fixed::nan().uraw() : uraw_t{0};
+		}
+		return event;
+	}
+}
+
+// Whether the serial acc + x overflows the finite range.
+template <FixedPolicy policy>
+constexpr bool _fm_scan_overflow(fixed<policy> acc, fixed<policy> x) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	if constexpr (policy::strict_mode) {
+		if (acc.is_nan() || acc.is_inf() || x.is_nan() || x.is_inf()) {
+			return false;
+		}
+	}
+	bool overflow = false;
+	const raw_t r = _fm_checked_add(acc.raw(), x.raw(), overflow);
+	return overflow || r > fixed::max_fix().raw() || r < fixed::min_fix().raw();
+}
+
+// Wrapping scan of one block, continuing from carry. Returns whether _fm_scan_event fired
+// anywhere in the block; the caller then replays the serial loop from the block start.
+template <FixedPolicy policy, bool exclusive>
+bool _fm_scan_block(const fixed<policy>* in, fixed<policy>* out, ::std::size_t count, typename fixed<policy>::uraw_t& carry) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	uraw_t acc = carry;
+	bool event = false;
+	if constexpr (policy::saturation_mode) {
+		// The overflow flag of the add itself is cheaper than the event word here.
+		for (::std::size_t i = 0; i < count; ++i) {
+			bool overflow = false;
+			const raw_t r = _fm_checked_add(static_cast<raw_t>(acc), in[i].raw(), overflow);
+			if (FIXMATH_UNLIKELY(overflow)) {
+				event = true;
+			}
+			out[i] = fixed::from_raw(exclusive ? acc : static_cast<uraw_t>(r));
+			acc = static_cast<uraw_t>(r);
+		}
+	} else {
+		uraw_t events = 0;
+		for (::std::size_t i = 0; i < count; ++i) {
+			const uraw_t x = in[i].uraw();
+			const uraw_t r = static_cast<uraw_t>(acc + x);
+			events |= _fm_scan_event<policy>(acc, x, r);
+			out[i] = fixed::from_raw(exclusive ? acc : r);
+			acc = r;
+		}
+		event = static_cast<raw_t>(events) < 0;
+	}
+	carry = acc;
+	return event;
+}
+
+// Replay the serial loop from first, where the serial accumulator still equals the wrapped
+// partial sum start. The inputs are recovered from the wrapped partial sums already in out,
+// so this also works when in and out are the same array.
+template <FixedPolicy policy>
+::std::size_t _fm_scan_replay(fixed<policy>* out, ::std::size_t first, ::std::size_t count, typename fixed<policy>::uraw_t start, typename fixed<policy>::uraw_t total, bool exclusive) {
+	using fixed = fixed<policy>;
+	using uraw_t = typename fixed::uraw_t;
+	::std::size_t first_overflow = count;
+	uraw_t previous = start;
+	fixed acc = fixed::from_raw(start);
+	for (::std::size_t i = first; i < count; ++i) {
+		const uraw_t wrapped = exclusive ? (i + 1 < count ? out[i + 1].uraw() : total) : out[i].uraw();
+		const fixed x = fixed::from_raw(static_cast<uraw_t>(wrapped - previous));
+		previous = wrapped;
+		if (first_overflow == count && _fm_scan_overflow<policy>(acc, x)) {
+			first_overflow = i;
+		}
+		if (exclusive) {
+			out[i] = acc;
+			acc = acc + x;
+		} else {
+			acc = acc + x;
+			out[i] = acc;
+		}
+	}
+	return first_overflow;
+}
+
+// Two passes when several threads run: block totals, then each block scans from the prefix
+// of the totals before it. Wrapping addition is associative, so the blocks agree with the
+// serial loop until the first block that reports an event, which is replayed serially.
+template <FixedPolicy policy>
+::std::size_t _fm_scan(::std::span<const fixed<policy>> in, ::std::span<fixed<policy>> out, fixed<policy> init, bool exclusive, const parallel::options& opts) {
+	using uraw_t = typename fixed<policy>::uraw_t;
+	FIXMATH_ASSERT(in.size() == out.size(), "scan output must have the input's length");
+	const ::std::size_t count = ::std::min(in.size(), out.size());
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	const ::std::size_t tasks = _fm_task_count(count, grain);
+	::std::vector<uraw_t> carries(tasks + 1);
+	::std::vector<char> events(tasks);
+	carries[0] = init.uraw();
+	if (_fm_thread_count(opts.thread_count, tasks) <= 1) {
+		uraw_t carry = carries[0];
+		for (::std::size_t task = 0; task < tasks; ++task) {
+			const ::std::size_t first = task * grain;
+			events[task] = exclusive ? _fm_scan_block<policy, true>(in.data() + first, out.data() + first, ::std::min(grain, count - first), carry)
+			                          : _fm_scan_block<policy, false>(in.data() + first, out.data() + first, ::std::min(grain, count - first), carry);
+			carries[task + 1] = carry;
+		}
+	} else {
+		_fm_parallel_for(tasks, opts.thread_count, [&](::std::size_t task) {
+			const ::std::size_t first = task * grain;
+			const ::std::size_t last = ::std::min(first + grain, count);
+			uraw_t sum = 0;
+			for (::std::size_t i = first; i < last; ++i) {
+				sum = static_cast<uraw_t>(sum + in[i].uraw());
+			}
+			carries[task + 1] = sum;
+		});
+		for (::std::size_t task = 0; task < tasks; ++task) {
+			carries[task + 1] = static_cast<uraw_t>(carries[task + 1] + carries[task]);
+		}
+		_fm_parallel_for(tasks, opts.thread_count, [&](::std::size_t task) {
+			const ::std::size_t first = task * grain;
+			uraw_t carry = carries[task];
+			events[task] = exclusive ? _fm_scan_block<policy, true>(in.data() + first, out.data() + first, ::std::min(grain, count - first), carry)
+			                          : _fm_scan_block<policy, false>(in.data() + first, out.data() + first, ::std::min(grain, count - first), carry);
+		});
+	}
+	for (::std::size_t task = 0; task < tasks; ++task) {
+		if (events[task]) {
+			return _fm_scan_replay<policy>(out.data(), task * grain, count, carries[task], carries[tasks], exclusive);
+		}
+	}
+	return count;
+}
+
+namespace parallel {
+
+template <FixedPolicy policy>
+reduction<policy> reduce(::std::span<const fixed<policy>> values, const options& opts) {
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	::std::vector<_fm_reduce_part> parts(_fm_task_count(values.size(), grain));
+	_fm_parallel_for(parts.size(), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		parts[task] = _fm_reduce_sum<policy>(values.data() + first, ::std::min(grain, values.size() - first));
+	});
+	return _fm_reduce_finish<policy>(parts, 0);
+}
+
+template <FixedPolicy policy>
+reduction<policy> dot(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, const options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size(), "dot operands must have the same length");
+	const ::std::size_t count = ::std::min(a.size(), b.size());
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	::std::vector<_fm_reduce_part> parts(_fm_task_count(count, grain));
+	_fm_parallel_for(parts.size(), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		parts[task] = _fm_reduce_dot<policy>(a.data() + first, b.data() + first, ::std::min(grain, count - first));
+	});
+	reduction<policy> result = _fm_reduce_finish<policy>(parts, static_cast<int>(fixed<policy>::FRACTION_BITS));
+	result.partial_overflow = false;
+	return result;
+}
+
+template <FixedPolicy policy>
+void multiply(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size() && a.size() == out.size(), "multiply operands and output must have the same length");
+	const ::std::size_t count = ::std::min({a.size(), b.size(), out.size()});
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int64_t)) {
+			if (_fm_cpu().avx512ifma) {
+				_fm_multiply_block_avx512ifma<policy>(a.data() + first, b.data() + first, out.data() + first, last - first);
+				return;
+			}
+		} else if constexpr (_fm_narrow_simd<policy>) {
+			if (_fm_cpu().avx2) {
+				_fm_multiply_block_avx2<policy>(a.data() + first, b.data() + first, out.data() + first, last - first);
+				return;
+			}
+		}
+#endif
+		for (::std::size_t i = first; i < last; ++i) {
+			out[i] = a[i] * b[i];
+		}
+	});
+}
+
+template <FixedPolicy policy>
+void divide(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size() && a.size() == out.size(), "divide operands and output must have the same length");
+	const ::std::size_t count = ::std::min({a.size(), b.size(), out.size()});
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int32_t) && !policy::strict_mode) {
+			if (_fm_cpu().avx2) {
+				_fm_divide_block_avx2<policy>(a.data() + first, b.data() + first, out.data() + first, last - first);
+				return;
+			}
+		}
+#endif
+		for (::std::size_t i = first; i < last; ++i) {
+			out[i] = a[i] / b[i];
+		}
+	});
+}
+
+template <FixedPolicy policy>
+void add(::std::span<const fixed<policy>> a, ::std::span<const fixed<policy>> b, ::std::span<fixed<policy>> out, const options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size() && a.size() == out.size(), "add operands and output must have the same length");
+	const ::std::size_t count = ::std::min({a.size(), b.size(), out.size()});
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (_fm_narrow_simd<policy>) {
+			if (_fm_cpu().avx2) {
+				_fm_add_block_avx2<policy>(a.data() + first, b.data() + first, out.data() + first, last - first);
+				return;
+			}
+		}
+#endif
+		for (::std::size_t i = first; i < last; ++i) {
+			out[i] = a[i] + b[i];
+		}
+	});
+}
+
+template <FixedPolicy policy>
+fixed<policy> min(::std::span<const fixed<policy>> values, const options& opts) {
+	return _fm_reduce_extreme<policy, false>(values, opts);
+}
+
+template <FixedPolicy policy>
+fixed<policy> max(::std::span<const fixed<policy>> values, const options& opts) {
+	return _fm_reduce_extreme<policy, true>(values, opts);
+}
+
+template <FixedPolicy policy>
+::std::size_t inclusive_scan(::std::span<const fixed<policy>> in, ::std::span<fixed<policy>> out, const options& opts) {
+	return _fm_scan<policy>(in, out, fixed<policy>{}, false, opts);
+}
+
+template <FixedPolicy policy>
+::std::size_t exclusive_scan(::std::span<const fixed<policy>> in, ::std::span<fixed<policy>> out, fixed<policy> init, const options& opts) {
+	return _fm_scan<policy>(in, out, init, true, opts);
+}
+
+} // namespace parallel
+
+} // namespace fixmath
@@ -0,0 +1,37 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <memory> // for std::start_lifetime_as_array
+#include <span>   // for std::span
+#include "fixed.hpp"
+
+namespace fixmath {
+
+// Element types a fixed<policy> view may be made of: the raw type itself or its unsigned
+// counterpart, which the aliasing rules let access the same objects. Other integers of the
+// same width, such as long against long long, are distinct types that may not alias.
+template <class Raw, class policy>
+concept _fm_raw_element = FixedPolicy<policy> && (::std::same_as<::std::remove_const_t<Raw>, typename policy::raw_t> || ::std::same_as<::std::remove_const_t<Raw>, typename fixed<policy>::uraw_t>);
+
+// Zero-copy views between raw integer buffers and fixed spans. A fixed<policy> is a
+// standard-layout wrapper of exactly one raw_t with the same size and alignment, so the two
+// views address the same bytes and neither copies or converts. Without
+// std::start_lifetime_as_array this depends on implementation behavior; see
+// docs/integration/raw-spans.md. The raw values are taken as they are, including the nan and inf
+// patterns of strict mode.
+template <FixedPolicy policy, class Raw, ::std::size_t Extent>
+	requires(_fm_raw_element<Raw, policy>)
+::std::span<::std::conditional_t<::std::is_const_v<Raw>, const fixed<policy>, fixed<policy>>, Extent> as_fixed_span(::std::span<Raw, Extent> raw);
+
+template <FixedPolicy policy, ::std::size_t Extent>
+::std::span<typename policy::raw_t, Extent> as_raw_span(::std::span<fixed<policy>, Extent> values);
+
+template <FixedPolicy policy, ::std::size_t Extent>
+::std::span<const typename policy::raw_t, Extent> as_raw_span(::std::span<const fixed<policy>, Extent> values);
+
+} // namespace fixmath
+
+#include "fixed_span.inl"
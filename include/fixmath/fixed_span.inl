@@ -0,0 +1,58 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// The layout the views depend on: a fixed and its raw_t occupy the same bytes.
+template <FixedPolicy policy>
+constexpr bool _fm_raw_layout() {
+	using fixed = fixed<policy>;
+	static_assert(::std::is_standard_layout_v<fixed>, "fixed must be standard-layout to share storage with its raw_t");
+	static_assert(::std::is_trivially_copyable_v<fixed>, "fixed must be trivially copyable to share storage with its raw_t");
+	static_assert(sizeof(fixed) == sizeof(typename policy::raw_t), "fixed must have the size of its raw_t");
+	static_assert(alignof(fixed) == alignof(typename policy::raw_t), "fixed must have the alignment of its raw_t");
+	return true;
+}
+
+// The n objects at data, viewed as To. Where the library has std::start_lifetime_as_array, the
+// objects are created in place from the existing bytes, which the standard defines. Otherwise
+// the pointer is cast, and the view relies on the compiler treating a standard-layout wrapper
+// and its only member as the same storage, as GCC, Clang, and MSVC do; C++20 itself does not
+// define access to objects that were never created.
+template <class To, class From>
+To* _fm_view_as(From* data, ::std::size_t n) {
+#if defined(__cpp_lib_start_lifetime_as)
+	if (n != 0) {
+		return ::std::start_lifetime_as_array<::std::remove_const_t<To>>(data, n);
+	}
+#else
+	(void)n;
+#endif
+	return reinterpret_cast<To*>(data);
+}
+
+template <FixedPolicy policy, class Raw, ::std::size_t Extent>
+	requires(_fm_raw_element<Raw, policy>)
+::std::span<::std::conditional_t<::std::is_const_v<Raw>, const fixed<policy>, fixed<policy>>, Extent> as_fixed_span(::std::span<Raw, Extent> raw) {
+	static_assert(_fm_raw_layout<policy>());
+	using element = ::std::conditional_t<::std::is_const_v<Raw>, const fixed<policy>, fixed<policy>>;
+	return ::std::span<element, Extent>(_fm_view_as<element>(raw.data(), raw.size()), raw.size());
+}
+
+template <FixedPolicy policy, ::std::size_t Extent>
+::std::span<typename policy::raw_t, Extent> as_raw_span(::std::span<fixed<policy>, Extent> values) {
+	static_assert(_fm_raw_layout<policy>());
+	return ::std::span<typename policy::raw_t, Extent>(_fm_view_as<typename policy::raw_t>(values.data(), values.size()), values.size());
+}
+
+template <FixedPolicy policy, ::std::size_t Extent>
+::std::span<const typename policy::raw_t, Extent> as_raw_span(::std::span<const fixed<policy>, Extent> values) {
+	static_assert(_fm_raw_layout<policy>());
+	return ::std::span<const typename policy::raw_t, Extent>(_fm_view_as<const typename policy::raw_t>(values.data(), values.size()), values.size());
+}
+
+} // namespace fixmath
@@ -0,0 +1,61 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include "fixed.hpp"
+
+namespace fixmath {
+
+enum class status_flag : uint32_t {
+	// The exact result is outside the raw range: it saturated, or wrapped in Ignore mode.
+	Overflow = 1 << 0,
+	// A nonzero value was divided by zero.
+	DivideByZero = 1 << 1,
+	// Zero was divided by zero.
+	Invalid = 1 << 2,
+};
+
+// Sticky status flags in the manner of the IEEE 754 exception flags. The checked_ operations
+// only ever set flags, without branching on them, so a batch can run with one status and be
+// checked once at the end. Combine the statuses of several workers with |=.
+struct status {
+	uint32_t flags = 0;
+
+	constexpr bool any() const { return flags != 0; }
+	constexpr bool test(status_flag flag) const { return (flags & static_cast<uint32_t>(flag)) != 0; }
+	constexpr void raise(status_flag flag, bool condition) { flags |= static_cast<uint32_t>(condition) * static_cast<uint32_t>(flag); }
+	constexpr void clear() { flags = 0; }
+	constexpr status& operator|=(status other) {
+		flags |= other.flags;
+		return *this;
+	}
+};
+
+// Strict mode already reports these conditions in-band with nan and inf.
+template <class policy>
+concept _fm_status_policy = FixedPolicy<policy> && !policy::strict_mode;
+
+// The same values as the operators, except that division by zero does not trigger FIXMATH_ERROR.
+// Overflow selects the saturated or wrapped result without a branch. Multiplication always takes
+// the 128-bit product, because the int32 fast path of operator* is a data-dependent branch.
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_add(fixed<policy> a, fixed<policy> b, status& st);
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_sub(fixed<policy> a, fixed<policy> b, status& st);
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_mul(fixed<policy> a, fixed<policy> b, status& st);
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_div(fixed<policy> a, fixed<policy> b, status& st);
+
+} // namespace fixmath
+
+#include "fixed_status.inl"
@@ -0,0 +1,88 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Select the saturated value for a wrapped raw, or keep it in Ignore mode.
+template <FixedPolicy policy>
+constexpr typename policy::raw_t _fm_status_select(typename policy::raw_t r, bool overflow, bool positive) {
+	using fixed = fixed<policy>;
+	if constexpr (policy::saturation_mode) {
+		const typename policy::raw_t saturated = positive ? fixed::max_sat().raw() : fixed::min_sat().raw();
+		return overflow ? saturated : r;
+	} else {
+		return r;
+	}
+}
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_add(fixed<policy> a, fixed<policy> b, status& st) {
+	bool overflow = false;
+	const auto r = _fm_checked_add(a.raw(), b.raw(), overflow);
+	st.raise(status_flag::Overflow, overflow);
+	// a wrapped sum has the opposite sign, as in operator+
+	return fixed<policy>::from_raw(_fm_status_select<policy>(r, overflow, r <= 0));
+}
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_sub(fixed<policy> a, fixed<policy> b, status& st) {
+	bool overflow = false;
+	const auto r = _fm_checked_sub(a.raw(), b.raw(), overflow);
+	st.raise(status_flag::Overflow, overflow);
+	return fixed<policy>::from_raw(_fm_status_select<policy>(r, overflow, r <= 0));
+}
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_mul(fixed<policy> a, fixed<policy> b, status& st) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	if constexpr (sizeof(raw_t) == 8) {
+		raw_t rhi = 0;
+		raw_t r = 0;
+		if constexpr (FIXMATH_32BIT && fixed::FRACTION_BITS == 32) {
+			r = _fm_mulshr32<policy>(a.raw(), b.raw(), rhi);
+		} else {
+			r = _fm_mul128(a.raw(), b.raw(), rhi);
+			r = _fm_div2n_round<policy, fixed::FRACTION_BITS>(rhi, r, rhi);
+		}
+		const bool overflow = rhi != (r >> 63);
+		st.raise(status_flag::Overflow, overflow);
+		return fixed::from_raw(_fm_status_select<policy>(r, overflow, rhi >= 0));
+	} else {
+		int64_t r64 = a.raw();
+		r64 *= b.raw();
+		r64 = _fm_div2n_round<policy, fixed::FRACTION_BITS>(r64);
+		const bool overflow = r64 != static_cast<raw_t>(r64);
+		st.raise(status_flag::Overflow, overflow);
+		return fixed::from_raw(_fm_status_select<policy>(static_cast<raw_t>(r64), overflow, r64 >= 0));
+	}
+}
+
+template <FixedPolicy policy>
+	requires _fm_status_policy<policy>
+constexpr fixed<policy> checked_div(fixed<policy> a, fixed<policy> b, status& st) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	const bool by_zero = b.raw() == 0;
+	// divide by 1 instead of 0 and replace the quotient afterwards
+	const raw_t divisor = b.raw() | static_cast<raw_t>(by_zero);
+	int64_t qhi = 0;
+	const int64_t qlo = _fm_div_quotient<policy>(a.raw(), divisor, qhi);
+	const bool overflow = !by_zero && (qhi != (qlo >> 63) || qlo != static_cast<raw_t>(qlo));
+	st.raise(status_flag::Overflow, overflow);
+	st.raise(status_flag::DivideByZero, by_zero && a.raw() != 0);
+	st.raise(status_flag::Invalid, by_zero && a.raw() == 0);
+	const raw_t r = _fm_status_select<policy>(static_cast<raw_t>(qlo), overflow, qhi >= 0);
+	// operator/ returns nan for 0 / 0, and for any x / 0 in Ignore mode
+	const raw_t zero_quotient = _fm_status_select<policy>(fixed::nan().raw(), a.raw() != 0, a.raw() > 0);
+	return fixed::from_raw(by_zero ? zero_quotient : r);
+}
+
+} // namespace fixmath
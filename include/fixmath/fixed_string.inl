@@ -0,0 +1,264 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Minimal little-endian 256-bit unsigned integer for the exact 10^(F+1) fraction conversion.
+// See docs/design/decimal-from-string.md; 10^64 needs 213 value bits.
+struct _fm_uint256 {
+	uint64_t limb[4];
+};
+
+inline void _fm_mul10_add(_fm_uint256& value, uint64_t digit) {
+	uint64_t carry = digit;
+	for (uint64_t& limb : value.limb) {
+		uint64_t high = 0;
+		const uint64_t low = _fm_umul128(limb, 10, high);
+		bool overflow = false;
+		limb = _fm_checked_add(low, carry, overflow);
+		carry = high + overflow;
+	}
+	FIXMATH_ASSERT(carry == 0, "decimal accumulator overflow");
+}
+
+inline bool _fm_less(const _fm_uint256& a, const _fm_uint256& b) {
+	for (int i = 3; i >= 0; --i) {
+		if (a.limb[i] != b.limb[i]) {
+			return a.limb[i] < b.limb[i];
+		}
+	}
+	return false;
+}
+
+inline void _fm_sub(_fm_uint256& a, const _fm_uint256& b) {
+	bool borrow = false;
+	for (int i = 0; i < 4; ++i) {
+		bool borrow1 = false;
+		bool borrow2 = false;
+		a.limb[i] = _fm_checked_sub(a.limb[i], b.limb[i], borrow1);
+		a.limb[i] = _fm_checked_sub(a.limb[i], static_cast<uint64_t>(borrow), borrow2);
+		borrow = borrow1 || borrow2;
+	}
+}
+
+inline void _fm_shr1(_fm_uint256& value) {
+	for (int i = 0; i < 3; ++i) {
+		value.limb[i] = (value.limb[i] >> 1) | (value.limb[i + 1] << 63);
+	}
+	value.limb[3] >>= 1;
+}
+
+constexpr bool _fm_is_digit(char c) {
+	return '0' <= c && c <= '9';
+}
+
+constexpr int _fm_decimal_digits(uint64_t value) {
+	int digits = 1;
+	while (value >= 10) {
+		value /= 10;
+		++digits;
+	}
+	return digits;
+}
+
+// Parse one complete decimal field into a raw value. Returns false only for input that
+// does not match the grammar; numeric overflow writes +/-inf and succeeds.
+template <FixedPolicy policy>
+bool _fm_parse_decimal(const char* first, const char* last, typename fixed<policy>::raw_t& out) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	constexpr int F = static_cast<int>(fixed::FRACTION_BITS);
+	constexpr uint64_t POSITIVE_LIMIT = static_cast<uint64_t>(fixed::max_fix().raw());
+	constexpr uint64_t NEGATIVE_LIMIT = static_cast<uint64_t>(_fm_absraw(fixed::min_fix().raw()));
+
+	// 1. special-value fast path
+	const ::std::string_view text(first, static_cast<::std::size_t>(last - first));
+	if (text == "nan") {
+		out = fixed::nan().raw();
+		return true;
+	}
+	if (text == "inf" || text == "+inf") {
+		out = fixed::inf().raw();
+		return true;
+	}
+	if (text == "-inf") {
+		out = (-fixed::inf()).raw();
+		return true;
+	}
+
+	// 2. finite syntax scan
+	const char* p = first;
+	bool negative = false;
+	if (p != last && (*p == '+' || *p == '-')) {
+		negative = *p == '-';
+		++p;
+	}
+	const char* const int_first = p;
+	while (p != last && _fm_is_digit(*p)) {
+		++p;
+	}
+	const char* const int_last = p;
+	if (int_first == int_last) {
+		return false;
+	}
+	const char* frac_first = p;
+	const char* frac_last = p;
+	if (p != last && *p == '.') {
+		frac_first = ++p;
+		while (p != last && _fm_is_digit(*p)) {
+			++p;
+		}
+		frac_last = p;
+		if (frac_first == frac_last) {
+			return false;
+		}
+	}
+
+	// 3. exponent parsing, restricted to the int32_t range
+	int64_t exponent = 0;
+	if (p != last && (*p == 'e' || *p == 'E')) {
+		++p;
+		bool exponent_negative = false;
+		if (p != last && (*p == '+' || *p == '-')) {
+			exponent_negative = *p == '-';
+			++p;
+		}
+		if (p == last || !_fm_is_digit(*p)) {
+			return false;
+		}
+		const uint64_t limit = exponent_negative ? 2147483648ULL : 2147483647ULL;
+		uint64_t magnitude = 0;
+		for (; p != last && _fm_is_digit(*p); ++p) {
+			const uint64_t digit = static_cast<uint64_t>(*p - '0');
+			if (magnitude > limit / 10 || (magnitude == limit / 10 && digit > limit % 10)) {
+				return false;
+			}
+			magnitude = magnitude * 10 + digit;
+		}
+		exponent = exponent_negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+	}
+	if (p != last) {
+		return false;
+	}
+
+	// The significand digits are viewed as one sequence D = integer digits + fraction digits.
+	const int64_t int_count = static_cast<int64_t>(int_last - int_first);
+	const int64_t total_count = int_count + static_cast<int64_t>(frac_last - frac_first);
+	const auto digit_at = [&](int64_t position) -> uint64_t {
+		if (position < 0 || position >= total_count) {
+			return 0;
+		}
+		const char c = position < int_count ? int_first[position] : frac_first[position - int_count];
+		return static_cast<uint64_t>(c - '0');
+	};
+	int64_t first_nonzero = 0;
+	while (first_nonzero < total_count && digit_at(first_nonzero) == 0) {
+		++first_nonzero;
+	}
+
+	// 4. zero fast path
+	if (first_nonzero == total_count) {
+		out = raw_t{0};
+		return true;
+	}
+	int64_t last_nonzero = total_count - 1;
+	while (digit_at(last_nonzero) == 0) {
+		--last_nonzero;
+	}
+
+	// 5. logical decimal-point position: D[0, point) is the integer part
+	const int64_t point = int_count + exponent;
+	const uint64_t limit = negative ? NEGATIVE_LIMIT : POSITIVE_LIMIT;
+	const uint64_t integer_limit = limit >> F;
+	const auto overflow = [&] {
+		out = negative ? (-fixed::inf()).raw() : fixed::inf().raw();
+		return true;
+	};
+
+	// 6. integer overflow fast path
+	if (point - first_nonzero > _fm_decimal_digits(integer_limit)) {
+		return overflow();
+	}
+
+	// 7. integer-part accumulation
+	uint64_t integer = 0;
+	for (int64_t position = first_nonzero; position < point; ++position) {
+		const uint64_t digit = digit_at(position);
+		if (digit > integer_limit || integer > (integer_limit - digit) / 10) {
+			return overflow();
+		}
+		integer = integer * 10 + digit;
+	}
+
+	// 8. fractional-part conversion
+	uint64_t fraction = 0;
+	bool carry = false;
+	const int64_t fraction_count = last_nonzero + 1 - point;
+	if (fraction_count > 0 && fraction_count <= 19) {
+		// All significant fractional digits fit a uint64_t numerator d / 10^n, so
+		// floor(d * 2^F / 10^n) and its remainder give the same bits and rounding
+		// decision as the 10^(F+1) weights without the wide accumulator.
+		uint64_t numerator = 0;
+		uint64_t denominator = 1;
+		for (int64_t position = point; position <= last_nonzero; ++position) {
+			numerator = numerator * 10 + digit_at(position);
+			denominator *= 10;
+		}
+		uint64_t remainder = 0;
+		fraction = _fm_udiv128(numerator >> (64 - F), numerator << F, denominator, remainder);
+		if constexpr (policy::rounding) {
+			const uint64_t rest = denominator - remainder;
+			carry = remainder > rest || (remainder == rest && (fraction & 1));
+		}
+	} else if (fraction_count > 0) {
+		_fm_uint256 scaled = {};
+		_fm_uint256 weight = {{1, 0, 0, 0}};
+		for (int64_t position = point; position <= point + F; ++position) {
+			_fm_mul10_add(scaled, digit_at(position));
+			_fm_mul10_add(weight, 0);
+		}
+		const bool tail_nonzero = last_nonzero > point + F;
+		for (int i = 1; i <= F; ++i) {
+			_fm_shr1(weight);
+			if (!_fm_less(scaled, weight)) {
+				_fm_sub(scaled, weight);
+				fraction |= uint64_t{1} << (F - i);
+			}
+		}
+		if constexpr (policy::rounding) {
+			_fm_shr1(weight);
+			if (_fm_less(weight, scaled)) {
+				carry = true;
+			} else if (!_fm_less(scaled, weight)) {
+				carry = tail_nonzero || (fraction & 1);
+			}
+		}
+	}
+
+	const uint64_t magnitude = (integer << F) + fraction + carry;
+	if (magnitude > limit) {
+		return overflow();
+	}
+	const uraw_t umagnitude = static_cast<uraw_t>(magnitude);
+	out = static_cast<raw_t>(negative ? static_cast<uraw_t>(uraw_t{0} - umagnitude) : umagnitude);
+	return true;
+}
+
+// Parse a complete decimal string using the grammar in docs/design/decimal-from-string.md.
+// On a syntax error, returns false and leaves value unchanged.
+template <FixedPolicy policy>
+bool from_string(::std::string_view text, fixed<policy>& value) {
+	typename fixed<policy>::raw_t raw = 0;
+	if (!_fm_parse_decimal<policy>(text.data(), text.data() + text.size(), raw)) {
+		return false;
+	}
+	value = fixed<policy>::from_raw(raw);
+	return true;
+}
+
+} // namespace fixmath
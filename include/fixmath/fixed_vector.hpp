@@ -0,0 +1,232 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <span>   // for std::span
+#include <vector> // for std::vector
+#include "fixed.hpp"
+#include "fixed_parallel.hpp"
+
+namespace fixmath {
+
+template <class T, ::std::size_t N>
+struct vec;
+
+template <class T, ::std::size_t N>
+struct mat;
+
+template <class T, ::std::size_t N>
+class vec_soa;
+
+// Vectors and matrices of 2 to 4 components. Strict mode is not supported: a nan or inf
+// component has no useful geometric meaning.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr bool _fm_vec_policy = !policy::strict_mode && 2 <= N && N <= 4;
+
+// Vector with fixed-point components. Sums and scaling work component by component with
+// the ordinary operators; dot products and everything built on them add the full-width
+// products exactly and round once.
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+struct vec<fixed<policy>, N> {
+	using value_type = fixed<policy>;
+
+	value_type data[N] = {};
+
+	constexpr vec() = default;
+
+	template <class... Components>
+		requires(sizeof...(Components) == N && (::std::convertible_to<Components, value_type> && ...))
+	constexpr vec(Components... components) : data{static_cast<value_type>(components)...} {}
+
+	constexpr value_type& operator[](::std::size_t i) { return data[i]; }
+	constexpr const value_type& operator[](::std::size_t i) const { return data[i]; }
+
+	constexpr value_type& x() { return data[0]; }
+	constexpr value_type x() const { return data[0]; }
+	constexpr value_type& y() { return data[1]; }
+	constexpr value_type y() const { return data[1]; }
+	constexpr value_type& z()
+		requires(N >= 3)
+	{
+		return data[2];
+	}
+	constexpr value_type z() const
+		requires(N >= 3)
+	{
+		return data[2];
+	}
+	constexpr value_type& w()
+		requires(N >= 4)
+	{
+		return data[3];
+	}
+	constexpr value_type w() const
+		requires(N >= 4)
+	{
+		return data[3];
+	}
+
+	constexpr vec& operator+=(const vec& other);
+	constexpr vec& operator-=(const vec& other);
+	constexpr vec& operator*=(value_type scale);
+
+	friend constexpr bool operator==(const vec&, const vec&) = default;
+};
+
+template <class T>
+using vec2 = vec<T, 2>;
+template <class T>
+using vec3 = vec<T, 3>;
+template <class T>
+using vec4 = vec<T, 4>;
+
+// Square matrix stored as rows, so m[r][c] is row r, column c.
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+struct mat<fixed<policy>, N> {
+	using value_type = fixed<policy>;
+	using row_type = vec<value_type, N>;
+
+	row_type rows[N] = {};
+
+	constexpr mat() = default;
+
+	template <class... Rows>
+		requires(sizeof...(Rows) == N && (::std::same_as<Rows, row_type> && ...))
+	constexpr mat(const Rows&... r) : rows{r...} {}
+
+	static constexpr mat identity();
+
+	constexpr row_type& operator[](::std::size_t r) { return rows[r]; }
+	constexpr const row_type& operator[](::std::size_t r) const { return rows[r]; }
+
+	friend constexpr bool operator==(const mat&, const mat&) = default;
+};
+
+template <class T>
+using mat2 = mat<T, 2>;
+template <class T>
+using mat3 = mat<T, 3>;
+template <class T>
+using mat4 = mat<T, 4>;
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator+(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b);
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator-(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b);
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator-(const vec<fixed<policy>, N>& a);
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(const vec<fixed<policy>, N>& a, fixed<policy> b);
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(fixed<policy> a, const vec<fixed<policy>, N>& b);
+
+// Sum of a[k] * b[k], rounded once from the exact sum and saturated, or wrapped in Ignore
+// mode, like operator*.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> dot(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b);
+
+// Each component a.y * b.z - a.z * b.y and so on is rounded once.
+template <FixedPolicy policy>
+constexpr vec<fixed<policy>, 3> cross(const vec<fixed<policy>, 3>& a, const vec<fixed<policy>, 3>& b);
+
+// dot(a, a).
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> length_squared(const vec<fixed<policy>, N>& a);
+
+// Square root of the exact sum of squares, rounded once like sqrt. Unlike sqrt(dot(a, a)),
+// it stays exact for vectors whose squared length is outside the range of fixed<policy>;
+// only a length that is itself out of range saturates, or wraps in Ignore mode.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> length(const vec<fixed<policy>, N>& a);
+
+// Each component is one dot product of a row with v.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(const mat<fixed<policy>, N>& m, const vec<fixed<policy>, N>& v);
+
+// Each element is one dot product of a row of a with a column of b.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr mat<fixed<policy>, N> operator*(const mat<fixed<policy>, N>& a, const mat<fixed<policy>, N>& b);
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr mat<fixed<policy>, N> transpose(const mat<fixed<policy>, N>& m);
+
+// Many vectors stored as structure of arrays: one contiguous array per component, so batch
+// operations load eight x, eight y, ... components at once instead of shuffling them out of
+// interleaved vec values.
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+class vec_soa<fixed<policy>, N> {
+public:
+	using value_type = vec<fixed<policy>, N>;
+
+	vec_soa() = default;
+	explicit vec_soa(::std::size_t count);
+
+	::std::size_t size() const { return components_[0].size(); }
+	bool empty() const { return components_[0].empty(); }
+
+	void resize(::std::size_t count);
+	void reserve(::std::size_t count);
+	void clear();
+	void push_back(const value_type& v);
+
+	// Gather or scatter one vector.
+	value_type operator[](::std::size_t i) const;
+	void set(::std::size_t i, const value_type& v);
+
+	::std::span<fixed<policy>> component(::std::size_t k) { return components_[k]; }
+	::std::span<const fixed<policy>> component(::std::size_t k) const { return components_[k]; }
+
+	::std::span<fixed<policy>> x() { return components_[0]; }
+	::std::span<const fixed<policy>> x() const { return components_[0]; }
+	::std::span<fixed<policy>> y() { return components_[1]; }
+	::std::span<const fixed<policy>> y() const { return components_[1]; }
+	::std::span<fixed<policy>> z()
+		requires(N >= 3)
+	{
+		return components_[2];
+	}
+	::std::span<const fixed<policy>> z() const
+		requires(N >= 3)
+	{
+		return components_[2];
+	}
+	::std::span<fixed<policy>> w()
+		requires(N >= 4)
+	{
+		return components_[3];
+	}
+	::std::span<const fixed<policy>> w() const
+		requires(N >= 4)
+	{
+		return components_[3];
+	}
+
+private:
+	::std::vector<fixed<policy>> components_[N];
+};
+
+namespace parallel {
+
+// out[i] = m * in[i], with exactly the values of the scalar operator*. out must have the size
+// of in and may be in itself.
+template <FixedPolicy policy, ::std::size_t N>
+void transform(const mat<fixed<policy>, N>& m, const vec_soa<fixed<policy>, N>& in, vec_soa<fixed<policy>, N>& out, const options& opts = {});
+
+// out[i] = dot(a[i], b[i]). a, b, and out must have the same size.
+template <FixedPolicy policy, ::std::size_t N>
+void dot(const vec_soa<fixed<policy>, N>& a, const vec_soa<fixed<policy>, N>& b, ::std::span<fixed<policy>> out, const options& opts = {});
+
+} // namespace parallel
+
+} // namespace fixmath
+
+#include "fixed_vector.inl"
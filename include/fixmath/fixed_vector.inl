@@ -0,0 +1,377 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Sum of a[k] * b[k] over N pairs, rounded once like operator*.
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> _fm_fused_dot(const fixed<policy>* a, const fixed<policy>* b) {
+	if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+		// A product of 32-bit raws is at most 2^62, so only sums of several products near
+		// min_fix * min_fix leave int64_t; those take the wide path below.
+		int64_t sum = 0;
+		bool overflow = false;
+		for (::std::size_t k = 0; k < N; ++k) {
+			bool step_overflow = false;
+			sum = _fm_checked_add(sum, int64_t{a[k].raw()} * b[k].raw(), step_overflow);
+			overflow = overflow || step_overflow;
+		}
+		if (FIXMATH_LIKELY(!overflow)) {
+			return _fm_round_sum<policy>(sum);
+		}
+	}
+	_fm_int192 sum = {};
+	for (::std::size_t k = 0; k < N; ++k) {
+		_fm_add(sum, _fm_product192<policy>(a[k].raw(), b[k].raw()));
+	}
+	return _fm_round_sum<policy>(sum);
+}
+
+// a * b - c * d, rounded once like operator*.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_fused_diff(fixed<policy> a, fixed<policy> b, fixed<policy> c, fixed<policy> d) {
+	if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+		// both products of 32-bit raws lie in [-2^62 + 2^31, 2^62]
+		return _fm_round_sum<policy>(int64_t{a.raw()} * b.raw() - int64_t{c.raw()} * d.raw());
+	} else {
+		_fm_int192 sum = _fm_product192<policy>(c.raw(), d.raw());
+		_fm_neg(sum);
+		_fm_add(sum, _fm_product192<policy>(a.raw(), b.raw()));
+		return _fm_round_sum<policy>(sum);
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+constexpr vec<fixed<policy>, N>& vec<fixed<policy>, N>::operator+=(const vec& other) {
+	return *this = *this + other;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+constexpr vec<fixed<policy>, N>& vec<fixed<policy>, N>::operator-=(const vec& other) {
+	return *this = *this - other;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+constexpr vec<fixed<policy>, N>& vec<fixed<policy>, N>::operator*=(value_type scale) {
+	return *this = *this * scale;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+constexpr mat<fixed<policy>, N> mat<fixed<policy>, N>::identity() {
+	mat result;
+	for (::std::size_t k = 0; k < N; ++k) {
+		result.rows[k][k] = 1;
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator+(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b) {
+	vec<fixed<policy>, N> result;
+	for (::std::size_t k = 0; k < N; ++k) {
+		result[k] = a[k] + b[k];
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator-(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b) {
+	vec<fixed<policy>, N> result;
+	for (::std::size_t k = 0; k < N; ++k) {
+		result[k] = a[k] - b[k];
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator-(const vec<fixed<policy>, N>& a) {
+	vec<fixed<policy>, N> result;
+	for (::std::size_t k = 0; k < N; ++k) {
+		result[k] = -a[k];
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(const vec<fixed<policy>, N>& a, fixed<policy> b) {
+	vec<fixed<policy>, N> result;
+	for (::std::size_t k = 0; k < N; ++k) {
+		result[k] = a[k] * b;
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(fixed<policy> a, const vec<fixed<policy>, N>& b) {
+	return b * a;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> dot(const vec<fixed<policy>, N>& a, const vec<fixed<policy>, N>& b) {
+	return _fm_fused_dot<policy, N>(a.data, b.data);
+}
+
+template <FixedPolicy policy>
+constexpr vec<fixed<policy>, 3> cross(const vec<fixed<policy>, 3>& a, const vec<fixed<policy>, 3>& b) {
+	return {_fm_fused_diff(a.y(), b.z(), a.z(), b.y()), _fm_fused_diff(a.z(), b.x(), a.x(), b.z()), _fm_fused_diff(a.x(), b.y(), a.y(), b.x())};
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> length_squared(const vec<fixed<policy>, N>& a) {
+	return dot(a, a);
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr fixed<policy> length(const vec<fixed<policy>, N>& a) {
+	return _fm_hypot(a.data);
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr vec<fixed<policy>, N> operator*(const mat<fixed<policy>, N>& m, const vec<fixed<policy>, N>& v) {
+	vec<fixed<policy>, N> result;
+	for (::std::size_t r = 0; r < N; ++r) {
+		result[r] = _fm_fused_dot<policy, N>(m[r].data, v.data);
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr mat<fixed<policy>, N> operator*(const mat<fixed<policy>, N>& a, const mat<fixed<policy>, N>& b) {
+	const mat<fixed<policy>, N> columns = transpose(b);
+	mat<fixed<policy>, N> result;
+	for (::std::size_t r = 0; r < N; ++r) {
+		for (::std::size_t c = 0; c < N; ++c) {
+			result[r][c] = _fm_fused_dot<policy, N>(a[r].data, columns[c].data);
+		}
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+constexpr mat<fixed<policy>, N> transpose(const mat<fixed<policy>, N>& m) {
+	mat<fixed<policy>, N> result;
+	for (::std::size_t r = 0; r < N; ++r) {
+		for (::std::size_t c = 0; c < N; ++c) {
+			result[c][r] = m[r][c];
+		}
+	}
+	return result;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+vec_soa<fixed<policy>, N>::vec_soa(::std::size_t count) {
+	resize(count);
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+void vec_soa<fixed<policy>, N>::resize(::std::size_t count) {
+	for (::std::vector<fixed<policy>>& component : components_) {
+		component.resize(count);
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+void vec_soa<fixed<policy>, N>::reserve(::std::size_t count) {
+	for (::std::vector<fixed<policy>>& component : components_) {
+		component.reserve(count);
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+void vec_soa<fixed<policy>, N>::clear() {
+	for (::std::vector<fixed<policy>>& component : components_) {
+		component.clear();
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+void vec_soa<fixed<policy>, N>::push_back(const value_type& v) {
+	for (::std::size_t k = 0; k < N; ++k) {
+		components_[k].push_back(v[k]);
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+typename vec_soa<fixed<policy>, N>::value_type vec_soa<fixed<policy>, N>::operator[](::std::size_t i) const {
+	value_type v;
+	for (::std::size_t k = 0; k < N; ++k) {
+		v[k] = components_[k][i];
+	}
+	return v;
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+	requires(_fm_vec_policy<policy, N>)
+void vec_soa<fixed<policy>, N>::set(::std::size_t i, const value_type& v) {
+	for (::std::size_t k = 0; k < N; ++k) {
+		components_[k][i] = v[k];
+	}
+}
+
+// Vectors [first, last) of structure-of-arrays components. Each vector is read completely
+// before its result is written, so out may be in.
+template <FixedPolicy policy, ::std::size_t N>
+inline void _fm_transform_block(const mat<fixed<policy>, N>& m, const fixed<policy>* const* in, fixed<policy>* const* out, ::std::size_t first, ::std::size_t last) {
+	for (::std::size_t i = first; i < last; ++i) {
+		vec<fixed<policy>, N> v;
+		for (::std::size_t k = 0; k < N; ++k) {
+			v[k] = in[k][i];
+		}
+		const vec<fixed<policy>, N> r = m * v;
+		for (::std::size_t k = 0; k < N; ++k) {
+			out[k][i] = r[k];
+		}
+	}
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+inline void _fm_dot_block(const fixed<policy>* const* a, const fixed<policy>* const* b, fixed<policy>* out, ::std::size_t first, ::std::size_t last) {
+	for (::std::size_t i = first; i < last; ++i) {
+		fixed<policy> x[N];
+		fixed<policy> y[N];
+		for (::std::size_t k = 0; k < N; ++k) {
+			x[k] = a[k][i];
+			y[k] = b[k][i];
+		}
+		out[i] = _fm_fused_dot<policy, N>(x, y);
+	}
+}
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+// _fm_transform_block for 32-bit raws, eight vectors per step as the even and the odd
+// elements of one load per component. vpmuldq forms the exact 62-bit products, and a row's
+// 64-bit sum overflows only when several of them are near min_fix * min_fix; such blocks are
+// redone by the scalar path. Requires _fm_cpu().avx2.
+template <FixedPolicy policy, ::std::size_t N>
+FIXMATH_TARGET("avx2") void _fm_transform_block_avx2(const mat<fixed<policy>, N>& m, const fixed<policy>* const* in, fixed<policy>* const* out, ::std::size_t first, ::std::size_t last) {
+	__m256i factor[N][N];
+	for (::std::size_t r = 0; r < N; ++r) {
+		for (::std::size_t c = 0; c < N; ++c) {
+			factor[r][c] = _mm256_set1_epi32(m[r][c].raw());
+		}
+	}
+	::std::size_t i = first;
+	for (; i + 8 <= last; i += 8) {
+		__m256i even[N];
+		__m256i odd[N];
+		for (::std::size_t k = 0; k < N; ++k) {
+			even[k] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in[k] + i));
+			odd[k] = _mm256_srli_epi64(even[k], 32);
+		}
+		__m256i result[N];
+		__m256i overflow = _mm256_setzero_si256();
+		for (::std::size_t r = 0; r < N; ++r) {
+			__m256i sum_even = _mm256_mul_epi32(factor[r][0], even[0]);
+			__m256i sum_odd = _mm256_mul_epi32(factor[r][0], odd[0]);
+			for (::std::size_t c = 1; c < N; ++c) {
+				sum_even = _fm_add_epi64_avx2(sum_even, _mm256_mul_epi32(factor[r][c], even[c]), overflow);
+				sum_odd = _fm_add_epi64_avx2(sum_odd, _mm256_mul_epi32(factor[r][c], odd[c]), overflow);
+			}
+			result[r] = _fm_round64_pair_avx2<policy>(sum_even, sum_odd);
+		}
+		if (FIXMATH_UNLIKELY(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0)) {
+			_fm_transform_block<policy, N>(m, in, out, i, i + 8);
+			continue;
+		}
+		for (::std::size_t k = 0; k < N; ++k) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out[k] + i), result[k]);
+		}
+	}
+	_fm_transform_block<policy, N>(m, in, out, i, last);
+}
+
+// _fm_dot_block for 32-bit raws, in the same way. Requires _fm_cpu().avx2.
+template <FixedPolicy policy, ::std::size_t N>
+FIXMATH_TARGET("avx2") void _fm_dot_block_avx2(const fixed<policy>* const* a, const fixed<policy>* const* b, fixed<policy>* out, ::std::size_t first, ::std::size_t last) {
+	::std::size_t i = first;
+	for (; i + 8 <= last; i += 8) {
+		__m256i sum_even = _mm256_setzero_si256();
+		__m256i sum_odd = _mm256_setzero_si256();
+		__m256i overflow = _mm256_setzero_si256();
+		for (::std::size_t k = 0; k < N; ++k) {
+			const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a[k] + i));
+			const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b[k] + i));
+			sum_even = _fm_add_epi64_avx2(sum_even, _mm256_mul_epi32(x, y), overflow);
+			sum_odd = _fm_add_epi64_avx2(sum_odd, _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)), overflow);
+		}
+		if (FIXMATH_UNLIKELY(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0)) {
+			_fm_dot_block<policy, N>(a, b, out, i, i + 8);
+			continue;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _fm_round64_pair_avx2<policy>(sum_even, sum_odd));
+	}
+	_fm_dot_block<policy, N>(a, b, out, i, last);
+}
+#endif
+
+namespace parallel {
+
+template <FixedPolicy policy, ::std::size_t N>
+void transform(const mat<fixed<policy>, N>& m, const vec_soa<fixed<policy>, N>& in, vec_soa<fixed<policy>, N>& out, const options& opts) {
+	FIXMATH_ASSERT(in.size() == out.size(), "transform output must have the size of its input");
+	const ::std::size_t count = ::std::min(in.size(), out.size());
+	const fixed<policy>* in_components[N];
+	fixed<policy>* out_components[N];
+	for (::std::size_t k = 0; k < N; ++k) {
+		in_components[k] = in.component(k).data();
+		out_components[k] = out.component(k).data();
+	}
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int32_t)) {
+			if (_fm_cpu().avx2) {
+				_fm_transform_block_avx2<policy, N>(m, in_components, out_components, first, last);
+				return;
+			}
+		}
+#endif
+		_fm_transform_block<policy, N>(m, in_components, out_components, first, last);
+	});
+}
+
+template <FixedPolicy policy, ::std::size_t N>
+void dot(const vec_soa<fixed<policy>, N>& a, const vec_soa<fixed<policy>, N>& b, ::std::span<fixed<policy>> out, const options& opts) {
+	FIXMATH_ASSERT(a.size() == b.size() && a.size() == out.size(), "dot operands and output must have the same size");
+	const ::std::size_t count = ::std::min({a.size(), b.size(), out.size()});
+	const fixed<policy>* a_components[N];
+	const fixed<policy>* b_components[N];
+	for (::std::size_t k = 0; k < N; ++k) {
+		a_components[k] = a.component(k).data();
+		b_components[k] = b.component(k).data();
+	}
+	const ::std::size_t grain = opts.grain == 0 ? 1 : opts.grain;
+	_fm_parallel_for(_fm_task_count(count, grain), opts.thread_count, [&](::std::size_t task) {
+		const ::std::size_t first = task * grain;
+		const ::std::size_t last = ::std::min(first + grain, count);
+#if FIXMATH_USE_RUNTIME_DISPATCH
+		if constexpr (sizeof(typename policy::raw_t) == sizeof(int32_t)) {
+			if (_fm_cpu().avx2) {
+				_fm_dot_block_avx2<policy, N>(a_components, b_components, out.data(), first, last);
+				return;
+			}
+		}
+#endif
+		_fm_dot_block<policy, N>(a_components, b_components, out.data(), first, last);
+	});
+}
+
+} // namespace parallel
+
+} // namespace fixmath
@@ -0,0 +1,73 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <compare> // for std::strong_ordering
+#include "fixed.hpp"
+
+namespace fixmath {
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+class fixed_wide;
+
+// Exact a * b, kept in units of 2^-2F without rounding or saturation. Only narrow() rounds.
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr fixed_wide<policy> mul_wide(fixed<policy> a, fixed<policy> b);
+
+// Exact product or sum of products of fixed<policy> values. Comparisons and sums of products
+// need no normalization, so a loop that only compares products, or adds several before using
+// them, pays for one rounding at the end instead of one per operator*. The value is held in
+// 192 bits: a product of 64-bit raws takes up to 127, and the rest lets up to 2^64 products
+// be added without overflow. Strict mode is not supported: a nan or inf factor has no exact
+// product.
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+class fixed_wide {
+public:
+	using fixed_type = fixed<policy>;
+
+	constexpr fixed_wide() = default;
+
+	// Exact value of a; widening never rounds.
+	constexpr fixed_wide(fixed_type a);
+
+	// Round once to fixed<policy> with the given rounding mode, which defaults to the policy's,
+	// and saturate like operator*, or wrap in Ignore mode.
+	template <rounding_mode rounding = policy::rounding ? rounding_mode::RoundToEven : rounding_mode::RoundToZero>
+	constexpr fixed_type narrow() const;
+
+	constexpr fixed_wide& operator+=(const fixed_wide& other);
+	constexpr fixed_wide& operator-=(const fixed_wide& other);
+
+	// Hidden friends, so a fixed<policy> operand converts: mul_wide(a, b) < c compares the exact
+	// product with c.
+	friend constexpr fixed_wide operator+(fixed_wide a, const fixed_wide& b) { return a += b; }
+	friend constexpr fixed_wide operator-(fixed_wide a, const fixed_wide& b) { return a -= b; }
+	friend constexpr fixed_wide operator-(fixed_wide a) {
+		_fm_neg(a.value_);
+		return a;
+	}
+
+	friend constexpr bool operator==(const fixed_wide& a, const fixed_wide& b) {
+		return a.value_.limb[0] == b.value_.limb[0] && a.value_.limb[1] == b.value_.limb[1] && a.value_.limb[2] == b.value_.limb[2];
+	}
+	friend constexpr ::std::strong_ordering operator<=>(const fixed_wide& a, const fixed_wide& b) {
+		if (_fm_less(a.value_, b.value_)) {
+			return ::std::strong_ordering::less;
+		}
+		return a == b ? ::std::strong_ordering::equal : ::std::strong_ordering::greater;
+	}
+
+private:
+	friend constexpr fixed_wide mul_wide<policy>(fixed_type a, fixed_type b);
+
+	_fm_int192 value_ = {};
+};
+
+} // namespace fixmath
+
+#include "fixed_wide.inl"
@@ -0,0 +1,76 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// policy with its rounding mode replaced. Strict mode is excluded by fixed_wide.
+template <FixedPolicy policy, rounding_mode rounding>
+using _fm_rounding_policy = fixed_policy<typename policy::raw_t, policy::fraction_bits, policy::ignore_mode ? arithmetic_mode::Ignore : arithmetic_mode::SaturationMode, rounding>;
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr fixed_wide<policy> mul_wide(fixed<policy> a, fixed<policy> b) {
+	fixed_wide<policy> result;
+	result.value_ = _fm_product192<policy>(a.raw(), b.raw());
+	return result;
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr fixed_wide<policy>::fixed_wide(fixed_type a) {
+	// raw * 2^F; F < 64, and the bits shifted out of the low word are the sign extension
+	const int64_t raw = a.raw();
+	value_ = _fm_make_int192(raw >> (64 - fixed_type::FRACTION_BITS), static_cast<uint64_t>(raw) << fixed_type::FRACTION_BITS);
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+template <rounding_mode rounding>
+constexpr fixed<policy> fixed_wide<policy>::narrow() const {
+	using rounding_policy = _fm_rounding_policy<policy, rounding>;
+	using raw_t = typename fixed_type::raw_t;
+	const int64_t hi = static_cast<int64_t>(value_.limb[1]);
+	const int64_t lo = static_cast<int64_t>(value_.limb[0]);
+	// One product, or a short sum of them, fits the word operator* rounds, so take its path
+	// and keep the 192-bit shift for values that need it.
+	if constexpr (sizeof(raw_t) < sizeof(int64_t)) {
+		if (FIXMATH_LIKELY(hi == (lo >> 63) && value_.limb[2] == value_.limb[1])) {
+			return fixed_type::from_raw(_fm_round_sum<rounding_policy>(lo).raw());
+		}
+	} else {
+		if (FIXMATH_LIKELY(value_.limb[2] == static_cast<uint64_t>(hi >> 63))) {
+			int64_t rhi = 0;
+			const int64_t r = _fm_div2n_round<rounding_policy, fixed_type::FRACTION_BITS>(hi, lo, rhi);
+			if constexpr (!policy::ignore_mode) {
+				if (FIXMATH_UNLIKELY(rhi != (r >> 63))) {
+					return rhi >= 0 ? fixed_type::max_sat() : fixed_type::min_sat();
+				}
+			}
+			return fixed_type::from_raw(raw_t{r});
+		}
+	}
+	bool overflow = false;
+	return fixed_type::from_raw(_fm_narrow192<rounding_policy>(value_, static_cast<int>(fixed_type::FRACTION_BITS), overflow));
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr fixed_wide<policy>& fixed_wide<policy>::operator+=(const fixed_wide& other) {
+	_fm_add(value_, other.value_);
+	return *this;
+}
+
+template <FixedPolicy policy>
+	requires(!policy::strict_mode)
+constexpr fixed_wide<policy>& fixed_wide<policy>::operator-=(const fixed_wide& other) {
+	_fm_int192 negated = other.value_;
+	_fm_neg(negated);
+	_fm_add(value_, negated);
+	return *this;
+}
+
+} // namespace fixmath
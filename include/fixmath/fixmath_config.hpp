@@ -110,3 +110,27 @@
 #	undef FIXMATH_GENERIC
 #	define FIXMATH_GENERIC 1
 #endif
+
+// Runtime CPU dispatch for the batch kernels of fixed_parallel.hpp. Requires GCC or Clang on
+// x86-64, where FIXMATH_TARGET compiles one function for extensions the build does not assume.
+#ifndef FIXMATH_USE_RUNTIME_DISPATCH
+#	define FIXMATH_USE_RUNTIME_DISPATCH FIXMATH_LINUX_X64
+#endif
+#if FIXMATH_USE_RUNTIME_DISPATCH && !FIXMATH_LINUX_X64
+#	undef FIXMATH_USE_RUNTIME_DISPATCH
+#	define FIXMATH_USE_RUNTIME_DISPATCH 0
+#endif
+#if FIXMATH_USE_RUNTIME_DISPATCH
+#	define FIXMATH_TARGET(features) __attribute__((target(features)))
+#endif
+
+// Per-thread counters of the branches the arithmetic operators take; see fixmath_counters.inl.
+// Disabled, FIXMATH_COUNT expands to nothing. Constant evaluation is never counted.
+#ifndef FIXMATH_USE_COUNTERS
+#	define FIXMATH_USE_COUNTERS 0
+#endif
+#if FIXMATH_USE_COUNTERS
+#	define FIXMATH_COUNT(name) (::std::is_constant_evaluated() ? (void)0 : ::fixmath::_fm_count(::fixmath::counter::name))
+#else
+#	define FIXMATH_COUNT(name) (void)0
+#endif
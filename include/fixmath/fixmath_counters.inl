@@ -0,0 +1,156 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// DO NOT MANULLY INCLUDE THIS FILE
+
+#if FIXMATH_USE_COUNTERS
+#	include <atomic> // for std::atomic
+#	include <mutex>  // for std::mutex
+#	include <vector> // for std::vector
+#endif
+
+namespace fixmath {
+
+// Branches of the arithmetic operators. Every call of operator* or operator/ counts exactly one
+// path or special exit; the Saturated counters are counted in addition to the path taken.
+enum class counter {
+	AddSaturated,  // operator+ overflowed and returned min_sat or max_sat
+	AddSpecial,    // operator+ returned early on a NaN or inf operand
+	SubSaturated,  // operator- overflowed and returned min_sat or max_sat
+	SubSpecial,    // operator- returned early on a NaN or inf operand
+	MulInt32,      // 64-bit raws that both fit int32: one 64-bit product
+	MulWide,       // 64-bit raws: 128-bit product by _fm_mul128 or _fm_mulshr32
+	MulNarrow,     // raws of at most 32 bits: one 64-bit product
+	MulSaturated,  // the product overflowed
+	MulSpecial,    // returned early on a NaN or inf operand
+	DivSimplified, // 64-bit raws: dividend shifted within 64 bits, one 64-bit division
+	DivShlN,       // 64-bit dividends too large for the simplified path: _fm_shlNdiv
+	DivNarrow,     // raws of at most 32 bits: one 64-bit division
+	DivSaturated,  // the quotient overflowed
+	DivSpecial,    // returned early on a NaN or inf operand
+	DivByZero,     // the divisor was zero
+	Count
+};
+
+constexpr const char* counter_name(counter c) {
+	constexpr const char* NAMES[] = {"AddSaturated", "AddSpecial", "SubSaturated", "SubSpecial", "MulInt32", "MulWide", "MulNarrow", "MulSaturated", "MulSpecial", "DivSimplified", "DivShlN", "DivNarrow", "DivSaturated", "DivSpecial", "DivByZero"};
+	static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == static_cast<::std::size_t>(counter::Count));
+	return NAMES[static_cast<::std::size_t>(c)];
+}
+
+struct counter_snapshot {
+	uint64_t values[static_cast<::std::size_t>(counter::Count)] = {};
+
+	constexpr uint64_t operator[](counter c) const {
+		return values[static_cast<::std::size_t>(c)];
+	}
+};
+
+#if FIXMATH_USE_COUNTERS
+
+// Each thread writes only its own block, so an increment is a relaxed load and store instead of
+// a locked read-modify-write. The atomics only keep reads from other threads race-free.
+struct _fm_counter_block {
+	::std::atomic<uint64_t> values[static_cast<::std::size_t>(counter::Count)] = {};
+
+	_fm_counter_block();
+	~_fm_counter_block();
+
+	void add_to(counter_snapshot& snapshot) const {
+		for (::std::size_t i = 0; i < static_cast<::std::size_t>(counter::Count); ++i) {
+			snapshot.values[i] += values[i].load(::std::memory_order_relaxed);
+		}
+	}
+
+	void clear() {
+		for (::std::atomic<uint64_t>& value : values) {
+			value.store(0, ::std::memory_order_relaxed);
+		}
+	}
+};
+
+struct _fm_counter_registry {
+	::std::mutex mutex;
+	::std::vector<_fm_counter_block*> live;
+	// counts of threads that have exited
+	counter_snapshot retired;
+};
+
+// Constructed by the first block, so it outlives every thread_local block, including the main thread's.
+inline _fm_counter_registry& _fm_counters() {
+	static _fm_counter_registry registry;
+	return registry;
+}
+
+inline _fm_counter_block::_fm_counter_block() {
+	_fm_counter_registry& registry = _fm_counters();
+	::std::lock_guard<::std::mutex> lock(registry.mutex);
+	registry.live.push_back(this);
+}
+
+inline _fm_counter_block::~_fm_counter_block() {
+	_fm_counter_registry& registry = _fm_counters();
+	::std::lock_guard<::std::mutex> lock(registry.mutex);
+	add_to(registry.retired);
+	::std::erase(registry.live, this);
+}
+
+inline thread_local _fm_counter_block _fm_thread_counters;
+
+inline void _fm_count(counter c) {
+	::std::atomic<uint64_t>& value = _fm_thread_counters.values[static_cast<::std::size_t>(c)];
+	value.store(value.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+}
+
+#endif
+
+namespace counters {
+
+// Counts of the calling thread. All zero unless FIXMATH_USE_COUNTERS is enabled.
+inline counter_snapshot snapshot() {
+	counter_snapshot result;
+#if FIXMATH_USE_COUNTERS
+	_fm_thread_counters.add_to(result);
+#endif
+	return result;
+}
+
+// Sum over every thread that has counted, including threads that have exited. Counts of a thread
+// that is still running may be read a few operations late.
+inline counter_snapshot snapshot_all_threads() {
+	counter_snapshot result;
+#if FIXMATH_USE_COUNTERS
+	_fm_counter_registry& registry = _fm_counters();
+	::std::lock_guard<::std::mutex> lock(registry.mutex);
+	result = registry.retired;
+	for (const _fm_counter_block* block : registry.live) {
+		block->add_to(result);
+	}
+#endif
+	return result;
+}
+
+// Zero the counts of the calling thread.
+inline void reset() {
+#if FIXMATH_USE_COUNTERS
+	_fm_thread_counters.clear();
+#endif
+}
+
+// Zero the counts of every thread. An increment that races with the reset on another thread may
+// survive it or restore the old count, so call this only while the workers are idle.
+inline void reset_all_threads() {
+#if FIXMATH_USE_COUNTERS
+	_fm_counter_registry& registry = _fm_counters();
+	::std::lock_guard<::std::mutex> lock(registry.mutex);
+	registry.retired = {};
+	for (_fm_counter_block* block : registry.live) {
+		block->clear();
+	}
+#endif
+}
+
+} // namespace counters
+
+} // namespace fixmath
@@ -0,0 +1,65 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Shared by several optional headers, so unlike the core .inl files this one is guarded.
+// DO NOT MANULLY INCLUDE THIS FILE
+
+#pragma once
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+#	include <cpuid.h>
+#	include <immintrin.h>
+#endif
+
+namespace fixmath {
+
+// Optional instruction set extensions of the running CPU. Kernels compiled with
+// FIXMATH_TARGET check these before they are called, so one binary runs everywhere.
+struct _fm_cpu_features {
+	bool avx2 = false;
+	bool avx512f = false;
+	bool avx512ifma = false;
+};
+
+inline _fm_cpu_features _fm_detect_cpu_features() {
+	_fm_cpu_features features;
+#if FIXMATH_USE_RUNTIME_DISPATCH
+	unsigned eax = 0;
+	unsigned ebx = 0;
+	unsigned ecx = 0;
+	unsigned edx = 0;
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return features;
+	}
+	unsigned leaf1_eax = 0;
+	unsigned leaf1_ebx = 0;
+	unsigned leaf1_ecx = 0;
+	unsigned leaf1_edx = 0;
+	__get_cpuid(1, &leaf1_eax, &leaf1_ebx, &leaf1_ecx, &leaf1_edx);
+	if ((leaf1_ecx >> 27) & 1) {
+		unsigned xcr0_lo = 0;
+		unsigned xcr0_hi = 0;
+		__asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+		// The OS must save the 256-bit registers: XCR0 bits 1 and 2.
+		if ((xcr0_lo & 0x6) == 0x6) {
+			features.avx2 = (ebx >> 5) & 1;
+		}
+		// AVX-512 also needs the opmask and all 512-bit registers: XCR0 bits 5 to 7.
+		if ((xcr0_lo & 0xe6) == 0xe6) {
+			features.avx512f = (ebx >> 16) & 1;
+			features.avx512ifma = features.avx512f && ((ebx >> 21) & 1);
+		}
+	}
+#endif
+	return features;
+}
+
+// Features of the running CPU, detected on first use. All false when
+// FIXMATH_USE_RUNTIME_DISPATCH is 0, which leaves only the portable kernels.
+inline const _fm_cpu_features& _fm_cpu() {
+	static const _fm_cpu_features features = _fm_detect_cpu_features();
+	return features;
+}
+
+} // namespace fixmath
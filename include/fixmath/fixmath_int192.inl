@@ -0,0 +1,134 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// intentionally omit header guard
+// DO NOT MANULLY INCLUDE THIS FILE
+
+namespace fixmath {
+
+// Two's complement 192-bit integer with little-endian limbs. Wide enough to sum 2^64
+// full 128-bit products exactly, which is what exact reductions and accumulators need.
+struct _fm_int192 {
+	uint64_t limb[3];
+};
+
+constexpr _fm_int192 _fm_make_int192(int64_t hi, uint64_t lo) {
+	return {{lo, static_cast<uint64_t>(hi), static_cast<uint64_t>(hi >> 63)}};
+}
+
+constexpr _fm_int192 _fm_make_int192(int64_t value) {
+	return _fm_make_int192(value >> 63, static_cast<uint64_t>(value));
+}
+
+constexpr bool _fm_is_negative(const _fm_int192& value) {
+	return static_cast<int64_t>(value.limb[2]) < 0;
+}
+
+constexpr void _fm_add(_fm_int192& a, const _fm_int192& b) {
+	bool carry0 = false;
+	bool carry1 = false;
+	bool carry2 = false;
+	a.limb[0] = _fm_checked_add(a.limb[0], b.limb[0], carry0);
+	a.limb[1] = _fm_checked_add(a.limb[1], b.limb[1], carry1);
+	a.limb[1] = _fm_checked_add(a.limb[1], static_cast<uint64_t>(carry0), carry2);
+	a.limb[2] += b.limb[2] + carry1 + carry2;
+}
+
+// Add a signed 128-bit value given as (hi, lo).
+constexpr void _fm_add(_fm_int192& a, int64_t hi, uint64_t lo) {
+	_fm_add(a, _fm_make_int192(hi, lo));
+}
+
+constexpr void _fm_neg(_fm_int192& value) {
+	bool borrow = true;
+	for (uint64_t& limb : value.limb) {
+		limb = ~limb + borrow;
+		borrow = borrow && limb == 0;
+	}
+}
+
+constexpr bool _fm_less(const _fm_int192& a, const _fm_int192& b) {
+	if (a.limb[2] != b.limb[2]) {
+		return static_cast<int64_t>(a.limb[2]) < static_cast<int64_t>(b.limb[2]);
+	}
+	if (a.limb[1] != b.limb[1]) {
+		return a.limb[1] < b.limb[1];
+	}
+	return a.limb[0] < b.limb[0];
+}
+
+// Divide by 2^shift, round as policy does, and fit the result into raw_t. overflow is set
+// when the rounded value lies outside [min_fix, max_fix]; the return value is then wrapped
+// in Ignore mode and max_sat/min_sat otherwise, matching the scalar operators.
+template <FixedPolicy policy>
+constexpr typename policy::raw_t _fm_narrow192(_fm_int192 value, int shift, bool& overflow) {
+	using fixed = fixed<policy>;
+	using raw_t = typename fixed::raw_t;
+	using uraw_t = typename fixed::uraw_t;
+	FIXMATH_ASSERT(0 <= shift && shift < 64, "shift out of range");
+
+	const bool negative = _fm_is_negative(value);
+	if (negative) {
+		_fm_neg(value);
+	}
+	uint64_t* const m = value.limb;
+	if (shift != 0) {
+		const uint64_t fraction = m[0] & ((uint64_t{1} << shift) - 1);
+		const uint64_t half = uint64_t{1} << (shift - 1);
+		m[0] = (m[0] >> shift) | (m[1] << (64 - shift));
+		m[1] = (m[1] >> shift) | (m[2] << (64 - shift));
+		m[2] >>= shift;
+		if constexpr (policy::rounding) {
+			if (fraction > half || (fraction == half && (m[0] & 1))) {
+				m[0] += 1;
+				m[1] += m[0] == 0;
+				m[2] += m[0] == 0 && m[1] == 0;
+			}
+		}
+	}
+
+	const uint64_t limit = negative ? static_cast<uint64_t>(_fm_absraw(fixed::min_fix().raw())) : static_cast<uint64_t>(fixed::max_fix().raw());
+	overflow = m[2] != 0 || m[1] != 0 || m[0] > limit;
+	if (overflow && !policy::ignore_mode) {
+		return negative ? fixed::min_sat().raw() : fixed::max_sat().raw();
+	}
+	const uraw_t magnitude = static_cast<uraw_t>(m[0]);
+	return static_cast<raw_t>(negative ? static_cast<uraw_t>(uraw_t{0} - magnitude) : magnitude);
+}
+
+// Exact a * b of two raws.
+template <FixedPolicy policy>
+constexpr _fm_int192 _fm_product192(typename policy::raw_t a, typename policy::raw_t b) {
+	if constexpr (sizeof(typename policy::raw_t) < sizeof(int64_t)) {
+		return _fm_make_int192(int64_t{a} * b);
+	} else {
+		int64_t hi = 0;
+		const int64_t lo = _fm_mul128(a, b, hi);
+		return _fm_make_int192(hi, static_cast<uint64_t>(lo));
+	}
+}
+
+// Round an exact sum of products once, saturated or wrapped like operator*.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_round_sum(const _fm_int192& sum) {
+	bool overflow = false;
+	return fixed<policy>::from_raw(_fm_narrow192<policy>(sum, static_cast<int>(fixed<policy>::FRACTION_BITS), overflow));
+}
+
+// The same for a sum of products of narrow raws that fits int64_t.
+template <FixedPolicy policy>
+constexpr fixed<policy> _fm_round_sum(int64_t sum) {
+	using fixed = fixed<policy>;
+	sum = _fm_div2n_round<policy, fixed::FRACTION_BITS>(sum);
+	if constexpr (!policy::ignore_mode) {
+		if (FIXMATH_UNLIKELY(sum > fixed::max_sat().raw())) {
+			return fixed::max_sat();
+		} else if (FIXMATH_UNLIKELY(sum < fixed::min_sat().raw())) {
+			return fixed::min_sat();
+		}
+	}
+	return fixed::from_raw(static_cast<typename policy::raw_t>(sum));
+}
+
+} // namespace fixmath
@@ -0,0 +1,115 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Shared by several optional headers, so unlike the core .inl files this one is guarded.
+// DO NOT MANULLY INCLUDE THIS FILE
+
+#pragma once
+
+#include <cerrno>       // for errno
+#include <system_error> // for std::errc
+
+// The mapping API follows the operating system rather than the compiler, so MinGW also uses Win32.
+#if defined(_WIN32)
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace fixmath {
+
+// Read-only mapping of a whole file. An empty file maps to a null pointer and zero size.
+class _fm_mapped_file {
+public:
+	_fm_mapped_file() = default;
+	_fm_mapped_file(const _fm_mapped_file&) = delete;
+	_fm_mapped_file& operator=(const _fm_mapped_file&) = delete;
+	~_fm_mapped_file() { close(); }
+
+	::std::errc open(const char* path) {
+		close();
+#if defined(_WIN32)
+		const HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return ::GetLastError() == ERROR_FILE_NOT_FOUND || ::GetLastError() == ERROR_PATH_NOT_FOUND ? ::std::errc::no_such_file_or_directory : ::std::errc::io_error;
+		}
+		LARGE_INTEGER size = {};
+		if (!::GetFileSizeEx(file, &size)) {
+			::CloseHandle(file);
+			return ::std::errc::io_error;
+		}
+		if (size.QuadPart != 0) {
+			const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			::CloseHandle(file);
+			if (mapping == nullptr) {
+				return ::std::errc::io_error;
+			}
+			void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			::CloseHandle(mapping);
+			if (view == nullptr) {
+				return ::std::errc::not_enough_memory;
+			}
+			data_ = static_cast<const char*>(view);
+			size_ = static_cast<::std::size_t>(size.QuadPart);
+		} else {
+			::CloseHandle(file);
+		}
+#else
+		const int fd = ::open(path, O_RDONLY);
+		if (fd < 0) {
+			return static_cast<::std::errc>(errno);
+		}
+		struct stat status = {};
+		if (::fstat(fd, &status) != 0) {
+			const int error = errno;
+			::close(fd);
+			return static_cast<::std::errc>(error);
+		}
+		if (status.st_size != 0) {
+			void* view = ::mmap(nullptr, static_cast<::std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			const int error = errno;
+			::close(fd);
+			if (view == MAP_FAILED) {
+				return static_cast<::std::errc>(error);
+			}
+			::madvise(view, static_cast<::std::size_t>(status.st_size), MADV_SEQUENTIAL);
+			data_ = static_cast<const char*>(view);
+			size_ = static_cast<::std::size_t>(status.st_size);
+		} else {
+			::close(fd);
+		}
+#endif
+		return ::std::errc{};
+	}
+
+	void close() {
+		if (data_ != nullptr) {
+#if defined(_WIN32)
+			::UnmapViewOfFile(data_);
+#else
+			::munmap(const_cast<char*>(data_), size_);
+#endif
+		}
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	const char* data() const { return data_; }
+	::std::size_t size() const { return size_; }
+
+private:
+	const char* data_ = nullptr;
+	::std::size_t size_ = 0;
+};
+
+} // namespace fixmath
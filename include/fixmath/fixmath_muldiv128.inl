@@ -63,6 +63,99 @@ inline uint64_t _fm_udiv128(uint64_t dhi, uint64_t dlo, uint64_t divisor, uint64
 #endif
 }
 
+// Reciprocal of a normalized divisor for _fm_udiv128_preinv: floor((2^128 - 1) / d) - 2^64.
+// Bitwise long division of (~d, 2^64 - 1) by d, meant for divisors known at compile time.
+constexpr uint64_t _fm_reciprocal_u64(uint64_t d) {
+	FIXMATH_ASSERT(d >> 63, "divisor must be normalized");
+	uint64_t remainder = ~d;
+	uint64_t quotient = 0;
+	for (int i = 0; i < 64; ++i) {
+		const bool carry = (remainder >> 63) != 0;
+		remainder = (remainder << 1) | 1;
+		quotient <<= 1;
+		if (carry || remainder >= d) {
+			remainder -= d;
+			quotient |= 1;
+		}
+	}
+	return quotient;
+}
+
+// Same contract as _fm_udiv128 for a normalized divisor d with v = _fm_reciprocal_u64(d),
+// using two multiplies and at most two corrections instead of a hardware division
+// (Moller and Granlund, "Improved division by invariant integers", Algorithm 4).
+inline uint64_t _fm_udiv128_preinv(uint64_t dhi, uint64_t dlo, uint64_t d, uint64_t v, uint64_t& remainder) {
+	FIXMATH_ASSERT(d >> 63, "divisor must be normalized");
+	FIXMATH_ASSERT(dhi < d, "128-bit quotient must fit 64 bits");
+	uint64_t quotient = 0;
+	const uint64_t estimate_lo = _fm_umul128(v, dhi, quotient);
+	const uint64_t fraction = estimate_lo + dlo;
+	quotient += dhi + 1 + (fraction < estimate_lo);
+	remainder = dlo - quotient * d;
+	if (remainder > fraction) {
+		--quotient;
+		remainder += d;
+	}
+	if (remainder >= d) {
+		++quotient;
+		remainder -= d;
+	}
+	return quotient;
+}
+
+// Seeds of _fm_reciprocal_u32: 2^24 / (i + 256.5) rounded, the reciprocal of the midpoint of
+// the divisors whose top nine bits are 256 + i, in units of 2^-15. Accurate to 9 bits.
+struct _fm_reciprocal_seeds {
+	uint16_t values[256] = {};
+
+	constexpr _fm_reciprocal_seeds() {
+		for (uint32_t i = 0; i < 256; ++i) {
+			values[i] = static_cast<uint16_t>(((uint32_t{1} << 26) / (513 + 2 * i) + 1) / 2);
+		}
+	}
+};
+
+inline constexpr _fm_reciprocal_seeds _FM_RECIPROCAL_SEEDS{};
+
+// Reciprocal of a normalized divisor for _fm_udiv64_preinv: floor((2^64 - 1) / d) - 2^32.
+// A table seed refined by two Newton steps, each of which doubles the correct bits, and one
+// exact correction. Every step is a 64-bit multiply, so this also suits targets whose 64-bit
+// division is a library call. Checked against the exact value for every normalized d.
+constexpr uint32_t _fm_reciprocal_u32(uint32_t d) {
+	FIXMATH_ASSERT(d >> 31, "divisor must be normalized");
+	const uint64_t wide_d = d;
+	// y0 ~ 2^47 / d; one step gives y1 ~ 2^63 / d to 18 bits, never above it
+	const uint64_t y0 = _FM_RECIPROCAL_SEEDS.values[(d >> 23) - 256];
+	const int64_t e0 = (int64_t{1} << 47) - static_cast<int64_t>(wide_d * y0);
+	const uint64_t y1 = (y0 << 16) + static_cast<uint64_t>((static_cast<int64_t>(y0) * e0) >> 31);
+	// e1 < 2^46, so dropping its low 16 bits keeps the product in 64 bits and costs no accuracy
+	const uint64_t e1 = (uint64_t{1} << 63) - wide_d * y1;
+	uint64_t y2 = (y1 << 1) + ((y1 * (e1 >> 16)) >> 46);
+	// y2 is floor((2^64 - 1) / d) or one less, so y2 * d does not wrap
+	const uint64_t remainder = ~(y2 * wide_d);
+	y2 += remainder >= wide_d;
+	return static_cast<uint32_t>(y2);
+}
+
+// Same contract as _fm_udiv128_preinv on 32-bit words: the quotient of (dhi, dlo) by a
+// normalized d with v = _fm_reciprocal_u32(d), which must fit 32 bits. Every multiply is
+// 32x32 -> 64, and the corrections are masks instead of branches.
+constexpr uint32_t _fm_udiv64_preinv(uint32_t dhi, uint32_t dlo, uint32_t d, uint32_t v, uint32_t& remainder) {
+	FIXMATH_ASSERT(d >> 31, "divisor must be normalized");
+	FIXMATH_ASSERT(dhi < d, "64-bit quotient must fit 32 bits");
+	const uint64_t estimate = static_cast<uint64_t>(v) * dhi + ((static_cast<uint64_t>(dhi) << 32) | dlo);
+	const uint32_t fraction = static_cast<uint32_t>(estimate);
+	uint32_t quotient = static_cast<uint32_t>(estimate >> 32) + 1;
+	remainder = dlo - quotient * d;
+	const uint32_t over = 0 - static_cast<uint32_t>(remainder > fraction);
+	quotient += over;
+	remainder += d & over;
+	const uint32_t under = 0 - static_cast<uint32_t>(remainder >= d);
+	quotient -= under;
+	remainder -= d & under;
+	return quotient;
+}
+
 struct _int128_s {
 	int64_t lo;
 	int64_t hi;
@@ -100,7 +193,7 @@ inline _int128_s _fm_div128(int64_t dhi, int64_t dlo, int64_t d, int64_t& rem) {
 }
 
 template <class policy, size_t N, class T>
-inline T _fm_div2n_round(T a) {
+constexpr T _fm_div2n_round(T a) {
 	// Divide by 2^N and round to nearest, ties to even (when enabled).
 	const int bits = sizeof(a) * 8;
 	static_assert(N < bits - (2 - std::is_unsigned<T>::value), "cannot touch sign bit");
@@ -121,7 +214,7 @@ inline T _fm_div2n_round(T a) {
 }
 
 template <class policy, size_t N>
-inline uint64_t _fm_umul64(uint64_t a, uint64_t b) {
+constexpr uint64_t _fm_umul64(uint64_t a, uint64_t b) {
 	// The caller must prove that the product fits uint64_t.
 	return _fm_div2n_round<policy, N>(a * b);
 }
@@ -131,7 +224,7 @@ inline T _fm_div2n_round(T a, uint64_t n) {
 	// Divide by 2^N and round to nearest, ties to even.
 	const int bits = sizeof(a) * 8;
 	(void)bits;
-	FIXMATH_ASSERT((n >= 0 && n < bits - (2 - std::is_unsigned<T>::value)), "bug");
+	FIXMATH_ASSERT(n < static_cast<uint64_t>(bits - (2 - std::is_unsigned<T>::value)), "bug");
 	if (n != 0) {
 		if constexpr (policy::rounding) {
 			using UT = typename std::make_unsigned<T>::type;
@@ -199,7 +292,49 @@ inline int64_t _fm_div2n_round(int64_t rhi, int64_t rlo, int64_t& ohi) {
 	return rlo;
 }
 
-inline _int128_s _fm_shl32div(int64_t a, int64_t b, int64_t& rem) {
+// (a * b) / 2^32 rounded as _fm_div2n_round<policy, 32>(rhi, rlo, ohi) after _fm_mul128, with
+// the same low word and ohi. Built from four 32x32 -> 64 multiplies for targets without a
+// 64x64 multiply. Only the product bits at or above 2^32 are assembled; the 32 bits below
+// come from the low partial product alone and decide the rounding.
+template <class policy>
+inline int64_t _fm_mulshr32(int64_t a, int64_t b, int64_t& ohi) {
+	const int32_t ahi = static_cast<int32_t>(a >> 32);
+	const uint32_t alo = static_cast<uint32_t>(a);
+	const int32_t bhi = static_cast<int32_t>(b >> 32);
+	const uint32_t blo = static_cast<uint32_t>(b);
+
+	const uint64_t low = uint64_t{alo} * blo;
+	const uint32_t fraction = static_cast<uint32_t>(low);
+	// Signed x unsigned partial products, from unsigned multiplies corrected for the sign.
+	const int64_t ahi_blo = static_cast<int64_t>(uint64_t{static_cast<uint32_t>(ahi)} * blo - (ahi < 0 ? uint64_t{blo} << 32 : 0));
+	const int64_t alo_bhi = static_cast<int64_t>(uint64_t{alo} * static_cast<uint32_t>(bhi) - (bhi < 0 ? uint64_t{alo} << 32 : 0));
+	// floor(a * b / 2^32) = quotient_hi * 2^32 + quotient_lo.
+	const int64_t middle = ahi_blo + static_cast<int64_t>(low >> 32);
+	const uint64_t quotient_lo = uint64_t{static_cast<uint32_t>(middle)} + static_cast<uint32_t>(alo_bhi);
+	int64_t quotient_hi = int64_t{ahi} * bhi + (middle >> 32) + (alo_bhi >> 32) + static_cast<int64_t>(quotient_lo >> 32);
+	uint32_t result_lo = static_cast<uint32_t>(quotient_lo);
+	bool increment = false;
+	if constexpr (policy::rounding) {
+		constexpr uint32_t HALF = uint32_t{1} << 31;
+		increment = fraction > HALF || (fraction == HALF && (result_lo & 1));
+	} else {
+		// Truncate toward zero: a negative floor with discarded bits moves up by one.
+		increment = quotient_hi < 0 && fraction != 0;
+	}
+	if (increment) {
+		++result_lo;
+		quotient_hi += result_lo == 0;
+	}
+	ohi = quotient_hi >> 32;
+	return static_cast<int64_t>((static_cast<uint64_t>(quotient_hi) << 32) | result_lo);
+}
+
+// (a << N) / b as a 128-bit quotient, with the remainder signed like a. Same results as
+// _fm_div128(a >> (64 - N), a << N, b, rem), but the dividend is assembled from |a| directly,
+// so the 128-bit negation and the general high-word shift are skipped.
+template <int N>
+inline _int128_s _fm_shlNdiv(int64_t a, int64_t b, int64_t& rem) {
+	static_assert(0 < N && N < 64, "shift must be in [1, 63]");
 	uint64_t absa = static_cast<uint64_t>(a);
 	uint64_t absb = static_cast<uint64_t>(b);
 	if (a < 0) {
@@ -211,23 +346,51 @@ inline _int128_s _fm_shl32div(int64_t a, int64_t b, int64_t& rem) {
 	uint64_t urem = 0;
 	uint64_t uqhi = 0;
 	uint64_t uqlo = 0;
-	uint64_t rs32 = absa >> 32;
-	if (rs32 >= absb) {
-		uqhi = rs32 / absb;
-		urem = rs32 % absb;
+	// high word of |a| << N; the quotient exceeds 64 bits only if it reaches |b|
+	const uint64_t shifted_hi = absa >> (64 - N);
+	if (shifted_hi >= absb) {
+		uqhi = shifted_hi / absb;
+		urem = shifted_hi % absb;
 	} else {
 		uqhi = 0;
-		urem = rs32;
-	}
-	uqlo = _fm_udiv128(urem, absa << 32, absb, urem);
-	if ((a ^ b) < 0) {
-		_fm_neg128(uqhi, uqlo);
+		urem = shifted_hi;
 	}
-	if (a < 0) {
-		urem = 0 - urem;
-	}
-	rem = static_cast<int64_t>(urem);
+	uqlo = _fm_udiv128(urem, absa << N, absb, urem);
+	// Apply the signs with masks: a branch on the quotient sign mispredicts on mixed-sign data.
+	const uint64_t negate = static_cast<uint64_t>((a ^ b) >> 63);
+	uqlo = (uqlo ^ negate) - negate;
+	uqhi = (uqhi ^ negate) + (negate & static_cast<uint64_t>(uqlo == 0));
+	const uint64_t negate_rem = static_cast<uint64_t>(a >> 63);
+	rem = static_cast<int64_t>((urem ^ negate_rem) - negate_rem);
 	return {static_cast<int64_t>(uqlo), static_cast<int64_t>(uqhi)};
 }
 
+// (a << N) / b for raws of at most 32 bits, with the remainder signed like a. The quotient
+// and remainder come from one _fm_udiv64_preinv on the normalized divisor, so no 64-bit
+// division is needed unless the quotient exceeds 32 bits, which saturates outside Ignore mode.
+template <int N>
+constexpr int64_t _fm_shlNdiv32(int32_t a, int32_t b, int64_t& rem) {
+	static_assert(0 < N && N < 32, "shift must be in [1, 31]");
+	const uint32_t absa = a < 0 ? 0 - static_cast<uint32_t>(a) : static_cast<uint32_t>(a);
+	const uint32_t absb = b < 0 ? 0 - static_cast<uint32_t>(b) : static_cast<uint32_t>(b);
+	const uint64_t dividend = static_cast<uint64_t>(absa) << N;
+	uint64_t uq = 0;
+	uint64_t urem = 0;
+	if (FIXMATH_UNLIKELY((dividend >> 32) >= absb)) {
+		uq = dividend / absb;
+		urem = dividend % absb;
+	} else {
+		const int shift = ::std::countl_zero(absb);
+		const uint32_t d = absb << shift;
+		const uint64_t shifted = dividend << shift;
+		uint32_t r = 0;
+		uq = _fm_udiv64_preinv(static_cast<uint32_t>(shifted >> 32), static_cast<uint32_t>(shifted), d, _fm_reciprocal_u32(d), r);
+		urem = r >> shift;
+	}
+	const uint64_t negate = static_cast<uint64_t>(static_cast<int64_t>(a ^ b) >> 63);
+	const uint64_t negate_rem = static_cast<uint64_t>(static_cast<int64_t>(a) >> 63);
+	rem = static_cast<int64_t>((urem ^ negate_rem) - negate_rem);
+	return static_cast<int64_t>((uq ^ negate) - negate);
+}
+
 } // namespace fixmath
@@ -0,0 +1,63 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Shared by several optional headers, so unlike the core .inl files this one is guarded.
+// DO NOT MANULLY INCLUDE THIS FILE
+
+#pragma once
+
+#include <atomic>  // for std::atomic
+#include <thread>  // for std::thread
+#include <vector>  // for std::vector
+
+namespace fixmath {
+
+// Resolve a requested worker count; 0 selects std::thread::hardware_concurrency().
+inline unsigned _fm_thread_count(unsigned requested, ::std::size_t task_count) {
+	// hardware_concurrency can read sysfs on every call, which costs more than a small task.
+	static const unsigned hardware = ::std::thread::hardware_concurrency();
+	unsigned count = requested != 0 ? requested : hardware;
+	if (count == 0) {
+		count = 1;
+	}
+	if (count > task_count) {
+		count = static_cast<unsigned>(task_count);
+	}
+	return count == 0 ? 1 : count;
+}
+
+// Run task(i) for every i in [0, task_count) on up to thread_count workers, including
+// the calling thread. Tasks are claimed dynamically, so callers must write each task's
+// result to its own slot and combine slots in index order afterwards.
+template <class Task>
+void _fm_parallel_for(::std::size_t task_count, unsigned thread_count, Task&& task) {
+	const unsigned workers = _fm_thread_count(thread_count, task_count);
+	if (workers <= 1) {
+		for (::std::size_t i = 0; i < task_count; ++i) {
+			task(i);
+		}
+		return;
+	}
+	::std::atomic<::std::size_t> next{0};
+	const auto worker = [&] {
+		for (;;) {
+			const ::std::size_t i = next.fetch_add(1, ::std::memory_order_relaxed);
+			if (i >= task_count) {
+				return;
+			}
+			task(i);
+		}
+	};
+	::std::vector<::std::thread> threads;
+	threads.reserve(workers - 1);
+	for (unsigned i = 1; i < workers; ++i) {
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (::std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+} // namespace fixmath
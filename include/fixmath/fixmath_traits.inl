@@ -25,6 +25,13 @@ enum class rounding_mode {
 	RoundToEven,
 };
 
+// Accuracy tier of the elementary functions, e.g. sin<precision::Fast>(x). See
+// docs/internals/function-approximations.md for the error bound of each tier.
+enum class precision {
+	Precise,
+	Fast,
+};
+
 template <class T>
 concept FixedUnderlying = ::std::signed_integral<T> && (sizeof(T) <= sizeof(int64_t));
 
@@ -0,0 +1,108 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Built separately from unit_tests.cpp: FIXMATH_USE_COUNTERS changes the operator definitions,
+// so it must have the same value in every translation unit of a program.
+#include <thread>
+#include "gtest/gtest.h"
+#define FIXMATH_USE_ASSERT 0
+#define FIXMATH_USE_COUNTERS 1
+#include "fixed.hpp"
+using namespace fixmath;
+using i64 = fixmath::int64_t;
+
+namespace {
+
+using Fix32 = fixmath::fixed<fixmath::fixed_policy<fixmath::int64_t, 32, fixmath::arithmetic_mode::SaturationMode, fixmath::rounding_mode::RoundToEven>>;
+using Fix32Strict = fixmath::fixed<fixmath::fixed_policy<fixmath::int64_t, 32, fixmath::arithmetic_mode::StrictMode, fixmath::rounding_mode::RoundToEven>>;
+using Fix48Even64 = fixmath::fixed<fixmath::fixed_policy<fixmath::int64_t, 48, fixmath::arithmetic_mode::SaturationMode, fixmath::rounding_mode::RoundToEven>>;
+using Fix8Even32 = fixmath::fixed<fixmath::fixed_policy<fixmath::int32_t, 8, fixmath::arithmetic_mode::SaturationMode, fixmath::rounding_mode::RoundToEven>>;
+
+// Only the listed counters may be non-zero.
+void check_counts(const counter_snapshot& snapshot, std::initializer_list<std::pair<counter, std::uint64_t>> expected) {
+	for (std::size_t i = 0; i < static_cast<std::size_t>(counter::Count); ++i) {
+		const counter c = static_cast<counter>(i);
+		std::uint64_t count = 0;
+		for (const auto& [expected_counter, expected_count] : expected) {
+			if (expected_counter == c) {
+				count = expected_count;
+			}
+		}
+		EXPECT_EQ(snapshot[c], count) << counter_name(c);
+	}
+}
+
+} // namespace
+
+TEST(FIXMATH, COUNTERS_MUL) {
+	counters::reset();
+	// raws that fit int32 are values below 0.5 in Q32.32
+	const Fix32 quarter = Fix32(0.25);
+	const Fix32 large = 1 << 20;
+	EXPECT_EQ(quarter * quarter, Fix32(0.0625));
+	EXPECT_EQ(quarter * large, 1 << 18);
+	EXPECT_EQ(large * large, Fix32::max_sat());
+	EXPECT_EQ(Fix8Even32(2) * Fix8Even32(5), 10);
+	check_counts(counters::snapshot(), {{counter::MulInt32, 1}, {counter::MulWide, 2}, {counter::MulSaturated, 1}, {counter::MulNarrow, 1}});
+
+	counters::reset();
+	EXPECT_TRUE((Fix32Strict::inf() * Fix32Strict(0)).is_nan());
+	EXPECT_TRUE((Fix32Strict::nan() * Fix32Strict(1)).is_nan());
+	EXPECT_EQ(Fix32Strict(1) * Fix32Strict(2), 2);
+	check_counts(counters::snapshot(), {{counter::MulSpecial, 2}, {counter::MulWide, 1}});
+
+	// constant evaluation is not counted
+	constexpr Fix8Even32 folded = Fix8Even32(2) * Fix8Even32(3);
+	static_assert(folded == 6);
+	check_counts(counters::snapshot(), {{counter::MulSpecial, 2}, {counter::MulWide, 1}});
+}
+
+TEST(FIXMATH, COUNTERS_DIV) {
+	counters::reset();
+	EXPECT_EQ(Fix32::from_raw(i64{1} << 20) / Fix32(1), Fix32::from_raw(i64{1} << 20));
+	EXPECT_EQ(Fix32(3) / Fix32(2), Fix32(1.5));
+	EXPECT_EQ(Fix48Even64(100) / Fix48Even64(4), 25);
+	EXPECT_EQ(Fix32(1 << 30) / Fix32::from_raw(i64{1}), Fix32::max_sat());
+	EXPECT_EQ(Fix8Even32(9) / Fix8Even32(3), 3);
+	EXPECT_EQ(Fix32(1) / Fix32(0), Fix32::max_sat());
+	check_counts(counters::snapshot(), {{counter::DivSimplified, 1}, {counter::DivShlN, 3}, {counter::DivSaturated, 1}, {counter::DivNarrow, 1}, {counter::DivByZero, 1}});
+
+	counters::reset();
+	EXPECT_TRUE((Fix32Strict(0) / Fix32Strict(0)).is_nan());
+	EXPECT_TRUE((Fix32Strict::inf() / Fix32Strict::inf()).is_nan());
+	EXPECT_EQ(Fix32Strict(1) / Fix32Strict::inf(), 0);
+	check_counts(counters::snapshot(), {{counter::DivByZero, 1}, {counter::DivSpecial, 2}});
+}
+
+TEST(FIXMATH, COUNTERS_ADD_SUB) {
+	counters::reset();
+	EXPECT_EQ(Fix32::max_sat() + Fix32(1), Fix32::max_sat());
+	EXPECT_EQ(Fix32::min_sat() - Fix32(1), Fix32::min_sat());
+	EXPECT_EQ(Fix32(1) + Fix32(1), 2);
+	EXPECT_TRUE((Fix32Strict::nan() - Fix32Strict(1)).is_nan());
+	check_counts(counters::snapshot(), {{counter::AddSaturated, 1}, {counter::SubSaturated, 1}, {counter::SubSpecial, 1}});
+}
+
+TEST(FIXMATH, COUNTERS_THREADS) {
+	counters::reset_all_threads();
+	Fix32 x = Fix32(0.25);
+	EXPECT_EQ(x * x, Fix32(0.0625));
+	std::thread worker([x] {
+		Fix32 y = x;
+		for (int i = 0; i < 10; ++i) {
+			y = y * Fix32(0.25);
+		}
+		EXPECT_EQ(y, Fix32::from_raw(i64{1} << 10));
+		// each thread sees only its own counts
+		EXPECT_EQ(counters::snapshot()[counter::MulInt32], 10u);
+	});
+	worker.join();
+	EXPECT_EQ(counters::snapshot()[counter::MulInt32], 1u);
+	// the exited worker's counts are retired into the total
+	EXPECT_EQ(counters::snapshot_all_threads()[counter::MulInt32], 11u);
+
+	counters::reset_all_threads();
+	check_counts(counters::snapshot_all_threads(), {});
+	check_counts(counters::snapshot(), {});
+}
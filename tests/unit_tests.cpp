@@ -4,11 +4,23 @@
 
 #define _NDEBUG 0
 #include <cmath>
+#include <cstdio>
+#include <functional>
 #include <limits>
 #include <random>
 #include "gtest/gtest.h"
 #define FIXMATH_USE_ASSERT 1
 #include "fixed.hpp"
+#include "fixed_csv.hpp"
+#include "fixed_column_file.hpp"
+#include "fixed_parallel.hpp"
+#include "fixed_fft.hpp"
+#include "fixed_filter.hpp"
+#include "fixed_status.hpp"
+#include "fixed_complex.hpp"
+#include "fixed_vector.hpp"
+#include "fixed_span.hpp"
+#include "fixed_wide.hpp"
 using namespace fixmath;
 
 std::mt19937_64 mtg{std::random_device{}()};
@@ -49,6 +61,15 @@ using Fix6Even8Ignore = TestFix<std::int8_t, 6, arithmetic_mode::Ignore, roundin
 using Fix7Even8Ignore = TestFix<std::int8_t, 7, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
 using Fix7Even16Ignore = TestFix<std::int16_t, 7, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
 using Fix7Even16Sat = TestFix<std::int16_t, 7, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+using Fix8Even16Sat = TestFix<std::int16_t, 8, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+using Fix8Zero16Sat = TestFix<std::int16_t, 8, arithmetic_mode::SaturationMode, rounding_mode::RoundToZero>;
+using Fix15Even16Sat = TestFix<std::int16_t, 15, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+using Fix15Zero16Sat = TestFix<std::int16_t, 15, arithmetic_mode::SaturationMode, rounding_mode::RoundToZero>;
+using Fix15Even16Ignore = TestFix<std::int16_t, 15, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
+using Fix15Even16Strict = TestFix<std::int16_t, 15, arithmetic_mode::StrictMode, rounding_mode::RoundToEven>;
+using Fix16Even32Sat = TestFix<int32_t, 16, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+using Fix16Zero32Sat = TestFix<int32_t, 16, arithmetic_mode::SaturationMode, rounding_mode::RoundToZero>;
+using Fix16Even32Ignore = TestFix<int32_t, 16, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
 using Fix31Zero32Ignore = TestFix<int32_t, 31, arithmetic_mode::Ignore, rounding_mode::RoundToZero>;
 using Fix31Even32Ignore = TestFix<int32_t, 31, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
 using Fix31Zero32Sat = TestFix<int32_t, 31, arithmetic_mode::SaturationMode, rounding_mode::RoundToZero>;
@@ -116,6 +137,19 @@ void check_fast64_horner(const typename Fix::raw_t (&coefficients)[N]) {
 	}
 }
 
+template <class Fix, std::size_t N>
+void check_fast64_estrin(const typename Fix::raw_t (&coefficients)[N]) {
+	using policy = typename Fix::policy;
+	using raw_t = typename Fix::raw_t;
+	// Both schemes return the constant term exactly at 0; elsewhere they round at different points.
+	EXPECT_EQ(_fm_estrin_fast64<policy>(0, &coefficients), coefficients[N - 1]);
+	const raw_t max_input = (Fix::quarter_pi() * Fix::quarter_pi()).raw();
+	const raw_t inputs[] = {1, max_input / 4, max_input / 2, max_input * 3 / 4, max_input - 1, max_input};
+	for (const raw_t input : inputs) {
+		EXPECT_LE(std::abs(_fm_estrin_fast64<policy>(input, &coefficients) - _fm_horner_generic<policy>(input, &coefficients)), static_cast<raw_t>(N));
+	}
+}
+
 template <class Fix>
 void check_fast128_horner() {
 	using policy = typename Fix::policy;
@@ -269,6 +303,76 @@ TEST(FIXMATH, INT128MUL) {
 	}
 }
 
+template <int N>
+void check_shln_div_matches_div128() {
+	std::uniform_int_distribution<i64> rand{i64l::min(), i64l::max()};
+	std::uniform_int_distribution<int> shift(0, 63);
+	for (int i = 0; i < 65536; ++i) {
+		const i64 a = i < 4 ? (i % 2 ? i64l::min() : i64l::max()) : rand(mtg) >> shift(mtg);
+		i64 b = rand(mtg) >> shift(mtg);
+		if (b == 0 || i % 16 == 1) {
+			b = i % 32 == 1 ? -1 : 1;
+		}
+		const i64 dhi = a >> (64 - N);
+		const i64 dlo = static_cast<i64>(static_cast<u64>(a) << N);
+		i64 expected_rem;
+		const auto expected = fixmath::_fm_div128(dhi, dlo, b, expected_rem);
+		i64 rem;
+		const auto r = fixmath::_fm_shlNdiv<N>(a, b, rem);
+		ASSERT_EQ(r.hi, expected.hi) << N << ": " << a << " / " << b;
+		ASSERT_EQ(r.lo, expected.lo) << N << ": " << a << " / " << b;
+		ASSERT_EQ(rem, expected_rem) << N << ": " << a << " / " << b;
+	}
+}
+
+TEST(FIXMATH, SHLNDIV) {
+	check_shln_div_matches_div128<1>();
+	check_shln_div_matches_div128<16>();
+	check_shln_div_matches_div128<31>();
+	check_shln_div_matches_div128<32>();
+	check_shln_div_matches_div128<40>();
+	check_shln_div_matches_div128<48>();
+	check_shln_div_matches_div128<62>();
+	check_shln_div_matches_div128<63>();
+}
+
+template <int N>
+void check_shln_div32_matches_division() {
+	using i32l = std::numeric_limits<std::int32_t>;
+	std::uniform_int_distribution<std::int32_t> rand{i32l::min(), i32l::max()};
+	std::uniform_int_distribution<int> shift(0, 31);
+	for (int i = 0; i < 65536; ++i) {
+		const std::int32_t a = i < 4 ? (i % 2 ? i32l::min() : i32l::max()) : rand(mtg) >> shift(mtg);
+		std::int32_t b = rand(mtg) >> shift(mtg);
+		if (b == 0 || i % 16 == 1) {
+			b = i % 32 == 1 ? -1 : 1;
+		} else if (i % 16 == 3) {
+			b = i32l::min();
+		}
+		const i64 dividend = i64{a} * (i64{1} << N);
+		i64 rem;
+		ASSERT_EQ(fixmath::_fm_shlNdiv32<N>(a, b, rem), dividend / b) << N << ": " << a << " / " << b;
+		ASSERT_EQ(rem, dividend % b) << N << ": " << a << " / " << b;
+	}
+}
+
+TEST(FIXMATH, SHLNDIV32) {
+	static_assert(fixmath::_fm_reciprocal_u32(0x80000000u) == 0xffffffffu);
+	static_assert(fixmath::_fm_reciprocal_u32(0xffffffffu) == 1);
+	static_assert(fixmath::_fm_reciprocal_u32(0xc0000000u) == 0x55555555u);
+	std::uniform_int_distribution<std::uint32_t> normalized{0x80000000u, 0xffffffffu};
+	for (int i = 0; i < 65536; ++i) {
+		const std::uint32_t d = normalized(mtg);
+		ASSERT_EQ(fixmath::_fm_reciprocal_u32(d), static_cast<std::uint32_t>(~u64{0} / d)) << d;
+	}
+	check_shln_div32_matches_division<1>();
+	check_shln_div32_matches_division<8>();
+	check_shln_div32_matches_division<15>();
+	check_shln_div32_matches_division<16>();
+	check_shln_div32_matches_division<24>();
+	check_shln_div32_matches_division<31>();
+}
+
 TEST(FIXMATH, INT128DIV) {
 	std::uniform_int_distribution<i64> rand{i64l::min(), i64l::max()};
 	for (int i = 0; i < 1048576; ++i) {
@@ -321,6 +425,91 @@ TEST(FIXMATH, UINT128DIV) {
 	EXPECT_EQ(remainder, DIVISOR - 1);
 }
 
+TEST(FIXMATH, UINT128DIV_PREINV) {
+	constexpr u64 DIVISORS[] = {0xc90f'daa2'2168'c235, u64{1} << 63, u64l::max()};
+	std::uniform_int_distribution<u64> rand{0, u64l::max()};
+	for (const u64 divisor : DIVISORS) {
+		const u64 reciprocal = fixmath::_fm_reciprocal_u64(divisor);
+		const u64 dividends[][2] = {{0, 0}, {0, divisor - 1}, {0, divisor}, {divisor - 1, u64l::max()}, {divisor - 1, 0}, {1, 0}};
+		for (const auto& dividend : dividends) {
+			u64 expected_remainder = 0;
+			u64 remainder = 0;
+			EXPECT_EQ(fixmath::_fm_udiv128_preinv(dividend[0], dividend[1], divisor, reciprocal, remainder), fixmath::_fm_udiv128(dividend[0], dividend[1], divisor, expected_remainder));
+			EXPECT_EQ(remainder, expected_remainder);
+		}
+		for (int i = 0; i < 65536; ++i) {
+			const u64 dhi = rand(mtg) % divisor;
+			const u64 dlo = rand(mtg);
+			u64 expected_remainder = 0;
+			u64 remainder = 0;
+			EXPECT_EQ(fixmath::_fm_udiv128_preinv(dhi, dlo, divisor, reciprocal, remainder), fixmath::_fm_udiv128(dhi, dlo, divisor, expected_remainder));
+			EXPECT_EQ(remainder, expected_remainder);
+		}
+	}
+	static_assert(fixmath::_fm_reciprocal_u64(u64{1} << 63) == u64l::max());
+	static_assert(fixmath::_fm_reciprocal_u64(u64l::max()) == 1);
+}
+
+template <class Fix>
+void check_mulshr32_matches_mul128(i64 a, i64 b) {
+	using policy = typename Fix::policy;
+	i64 expected_hi = 0;
+	i64 expected = fixmath::_fm_mul128(a, b, expected_hi);
+	expected = fixmath::_fm_div2n_round<policy, 32>(expected_hi, expected, expected_hi);
+	i64 hi = 0;
+	EXPECT_EQ(fixmath::_fm_mulshr32<policy>(a, b, hi), expected) << a << " * " << b;
+	EXPECT_EQ(hi, expected_hi) << a << " * " << b;
+}
+
+// operator*'s wide path as FIXMATH_32BIT builds take it, so that 64-bit hosts cover it too.
+template <class Fix>
+void check_mulshr32_matches_operator(i64 a, i64 b) {
+	using policy = typename Fix::policy;
+	const Fix x = Fix::from_raw(a);
+	const Fix y = Fix::from_raw(b);
+	if constexpr (policy::strict_mode) {
+		if (x.is_nan() || x.is_inf() || y.is_nan() || y.is_inf()) {
+			return;
+		}
+	}
+	i64 hi = 0;
+	i64 r = fixmath::_fm_mulshr32<policy>(a, b, hi);
+	if constexpr (!policy::ignore_mode) {
+		if (hi != (r >> 63)) {
+			r = hi >= 0 ? Fix::max_sat().raw() : Fix::min_sat().raw();
+		} else if (policy::strict_mode && r == Fix::nan().raw()) {
+			r = (-Fix::inf()).raw();
+		}
+	}
+	EXPECT_EQ(r, (x * y).raw()) << a << " * " << b;
+}
+
+TEST(FIXMATH, MULSHR32) {
+	constexpr i64 EDGES[] = {0, 1, -1, i64{1} << 31, -(i64{1} << 31), i64{1} << 32, -(i64{1} << 32), 0xffff'ffff, i64{3} << 31, i64l::max(), i64l::min()};
+	for (const i64 a : EDGES) {
+		for (const i64 b : EDGES) {
+			check_mulshr32_matches_mul128<Fix32>(a, b);
+			check_mulshr32_matches_mul128<Fix32Zero>(a, b);
+			check_mulshr32_matches_operator<Fix32>(a, b);
+			check_mulshr32_matches_operator<Fix32Zero>(a, b);
+			check_mulshr32_matches_operator<Fix32Ignore>(a, b);
+			check_mulshr32_matches_operator<Fix32Strict>(a, b);
+		}
+	}
+	std::uniform_int_distribution<i64> rand{i64l::min(), i64l::max()};
+	for (int i = 0; i < 65536; ++i) {
+		// narrow some operands so that products near the result range and exact ties are common
+		const i64 a = rand(mtg) >> (i & 31);
+		const i64 b = rand(mtg) >> ((i >> 5) & 31);
+		check_mulshr32_matches_mul128<Fix32>(a, b);
+		check_mulshr32_matches_mul128<Fix32Zero>(a, b);
+		check_mulshr32_matches_operator<Fix32>(a, b);
+		check_mulshr32_matches_operator<Fix32Zero>(a, b);
+		check_mulshr32_matches_operator<Fix32Ignore>(a, b);
+		check_mulshr32_matches_operator<Fix32Strict>(a, b);
+	}
+}
+
 TEST(FIXMATH, HIGH_PRECISION_PIO4_REMAINDER) {
 	auto reduced = fixmath::_fm_rem_pio4<32>(u64{0});
 	EXPECT_EQ(reduced.remainder, 0);
@@ -672,26 +861,57 @@ TEST(FIXMATH, TRIG_Q32_32_LARGE_RANGE_REDUCTION) {
 TEST(FIXMATH, TAN_KERNELS_Q32_32) {
 	const auto expect_tan_kernel_near = [](Fix32 input) {
 		const Fix32 expected(std::tan(static_cast<double>(input)));
-		const Fix32 actual = Fix32::from_raw(_fm_tan_kernel<Fix32::policy>(input.raw(), false));
+		const Fix32 actual = Fix32::from_raw(_fm_tan_kernel<precision::Precise, Fix32::policy>(input.raw(), false));
 		EXPECT_LE(std::abs(actual.raw() - expected.raw()), 1);
 	};
 	const auto expect_cot_residual_kernel_near = [](Fix32 input) {
 		const double value = static_cast<double>(input);
 		const Fix32 expected(1.0 / std::tan(value) - 1.0 / value);
-		const Fix32 actual = Fix32::from_raw(_fm_cot_residual_kernel<Fix32::policy>(input.raw()));
+		const Fix32 actual = Fix32::from_raw(_fm_cot_residual_kernel<precision::Precise, Fix32::policy>(input.raw()));
 		EXPECT_LE(std::abs(actual.raw() - expected.raw()), 1);
 	};
 
-	EXPECT_EQ(_fm_tan_kernel<Fix32::policy>(0, false), 0);
+	EXPECT_EQ((_fm_tan_kernel<precision::Precise, Fix32::policy>(0, false)), 0);
 	expect_tan_kernel_near(Fix32(0.1));
 	expect_tan_kernel_near(Fix32(0.3));
 	expect_tan_kernel_near(Fix32(0.46));
-	EXPECT_EQ(_fm_cot_residual_kernel<Fix32::policy>(0), 0);
+	EXPECT_EQ((_fm_cot_residual_kernel<precision::Precise, Fix32::policy>(0)), 0);
 	expect_cot_residual_kernel_near(Fix32(0.1));
 	expect_cot_residual_kernel_near(Fix32(0.3));
 	expect_cot_residual_kernel_near(Fix32(0.46));
 }
 
+TEST(FIXMATH, TRIG_Q32_32_FAST) {
+	using fixmath::precision;
+	// Documented tier bounds are 4812 ulp for sin/cos and 2709 ulp for tan/cot away from the poles.
+	const auto expect_near = [](Fix32 actual, double expected, Fix32::raw_t max_error) {
+		EXPECT_LE(std::abs(actual.raw() - Fix32(expected).raw()), max_error);
+	};
+	for (double x = -7.0; x <= 7.0; x += 0.0625) {
+		SCOPED_TRACE(x);
+		const Fix32 input(x);
+		expect_near(fixmath::sin<precision::Fast>(input), std::sin(x), 4813);
+		expect_near(fixmath::cos<precision::Fast>(input), std::cos(x), 4813);
+		if (std::abs(std::cos(x)) > 0.2) {
+			expect_near(fixmath::tan<precision::Fast>(input), std::tan(x), 2710);
+		}
+		if (std::abs(std::sin(x)) > 0.2) {
+			expect_near(fixmath::cot<precision::Fast>(input), std::cos(x) / std::sin(x), 2710);
+		}
+	}
+
+	EXPECT_EQ(fixmath::sin<precision::Fast>(Fix32(0)), Fix32(0));
+	EXPECT_EQ(fixmath::cos<precision::Fast>(Fix32(0)), Fix32(1));
+	EXPECT_EQ(fixmath::tan<precision::Fast>(Fix32::quarter_pi()), Fix32(1));
+	EXPECT_EQ(fixmath::tan<precision::Fast>(Fix32::half_pi()), Fix32::max_sat());
+	EXPECT_EQ(fixmath::cot<precision::Fast>(Fix32::half_pi()), Fix32(0));
+	const Fix32 half(0.5);
+	EXPECT_EQ(fixmath::sin<precision::Fast>(-half), -fixmath::sin<precision::Fast>(half));
+	EXPECT_EQ(fixmath::cos<precision::Fast>(-half), fixmath::cos<precision::Fast>(half));
+	EXPECT_EQ(fixmath::sin<precision::Precise>(half), fixmath::sin(half));
+	EXPECT_TRUE(fixmath::sin<precision::Fast>(Fix32Strict::nan()).is_nan());
+}
+
 TEST(FIXMATH, HORNER_Q32_FAST64) {
 	const Fix32::raw_t sin_coefficients[] = {11654LL, -852064LL, 35791363LL, -715827879LL, 4294967296LL};
 	const Fix32::raw_t cos_coefficients[] = {104756LL, -5964319LL, 178956784LL, -2147483636LL, 4294967296LL};
@@ -701,6 +921,16 @@ TEST(FIXMATH, HORNER_Q32_FAST64) {
 	check_fast64_horner<Fix32Zero>(cos_coefficients);
 }
 
+TEST(FIXMATH, ESTRIN_Q32_FAST64) {
+	const Fix32::raw_t sin_coefficients[] = {11654LL, -852064LL, 35791363LL, -715827879LL, 4294967296LL};
+	const Fix32::raw_t tan_coefficients[] = {49715989LL, 90993159LL, 232123842LL, 572645510LL, 1431656075LL, 4294967295LL};
+	const Fix32::raw_t fast_tan_coefficients[] = {277031939LL, 566404673LL, 1431927672LL, 4294965467LL};
+	check_fast64_estrin<Fix32>(sin_coefficients);
+	check_fast64_estrin<Fix32>(tan_coefficients);
+	check_fast64_estrin<Fix32>(fast_tan_coefficients);
+	check_fast64_estrin<Fix32Zero>(tan_coefficients);
+}
+
 TEST(FIXMATH, HORNER_Q32_FAST128) {
 	static_assert(Fix32::URATIO > static_cast<Fix32::uraw_t>(std::numeric_limits<Fix32::raw_t>::max()) / Fix32::URATIO);
 	check_fast128_horner<Fix32>();
@@ -893,6 +1123,75 @@ TEST(FIXMATH, DIV_IGNORE_ZERO) {
 	EXPECT_FIX_DOMAIN_ERROR(Fix32Ignore(1) / Fix32Ignore(0));
 }
 
+template <fixmath::_fm_fixed_constant C>
+void check_constant_ops_match_operators() {
+	using Fix = typename decltype(C)::value_type;
+	using raw_t = typename Fix::raw_t;
+	using raw_limits = std::numeric_limits<raw_t>;
+	const Fix c = Fix::from_raw(C.raw);
+	std::vector<raw_t> inputs = {0, 1, -1, 2, -3, raw_limits::max(), raw_limits::min(), raw_limits::max() - 1, raw_limits::min() + 1, raw_limits::min() + 2};
+	inputs.push_back(Fix(0.5).raw());
+	inputs.push_back(Fix(-1.5).raw());
+	std::uniform_int_distribution<i64> rand{i64l::min(), i64l::max()};
+	for (int i = 0; i < 4096; ++i) {
+		// random magnitudes, so that both the saturating and the in-range results are common
+		inputs.push_back(static_cast<raw_t>(rand(mtg) >> (64 - sizeof(raw_t) * CHAR_BIT + i % (sizeof(raw_t) * CHAR_BIT))));
+	}
+	for (const raw_t raw : inputs) {
+		const Fix a = Fix::from_raw(raw);
+		EXPECT_EQ(fixmath::mul_by<C>(a).raw(), (a * c).raw()) << +raw << " * " << +C.raw;
+		if constexpr (C.raw != 0) {
+			EXPECT_EQ(fixmath::div_by<C>(a).raw(), (a / c).raw()) << +raw << " / " << +C.raw;
+		}
+	}
+}
+
+template <class Fix>
+void check_constant_ops_for() {
+	using raw_t = typename Fix::raw_t;
+	check_constant_ops_match_operators<Fix(0)>();
+	check_constant_ops_match_operators<Fix(1)>();
+	check_constant_ops_match_operators<Fix(-1)>();
+	check_constant_ops_match_operators<Fix(3)>();
+	check_constant_ops_match_operators<Fix(-3)>();
+	check_constant_ops_match_operators<Fix(0.5)>();
+	check_constant_ops_match_operators<Fix(-0.25)>();
+	check_constant_ops_match_operators<Fix(1.0 / 3)>();
+	check_constant_ops_match_operators<Fix(-2.0 / 3)>();
+	check_constant_ops_match_operators<Fix(2.54)>();
+	check_constant_ops_match_operators<Fix::from_raw(raw_t{5})>();
+	check_constant_ops_match_operators<Fix::from_raw(raw_t{-12})>();
+	check_constant_ops_match_operators<Fix::epsilon()>();
+	check_constant_ops_match_operators<-Fix::epsilon()>();
+	check_constant_ops_match_operators<Fix(100)>();
+	check_constant_ops_match_operators<Fix::max_sat()>();
+	check_constant_ops_match_operators<Fix::min_sat()>();
+	check_constant_ops_match_operators<Fix::from_raw(std::numeric_limits<raw_t>::min())>();
+}
+
+TEST(FIXMATH, MUL_DIV_BY_CONSTANT) {
+	check_constant_ops_for<Fix32>();
+	check_constant_ops_for<Fix32Zero>();
+	check_constant_ops_for<Fix32Ignore>();
+	check_constant_ops_for<Fix32Strict>();
+	check_constant_ops_for<Fix16Even64>();
+	check_constant_ops_for<Fix48Even64>();
+	check_constant_ops_for<Fix62Zero64Sat>();
+	check_constant_ops_for<Fix63Even64Strict>();
+	check_constant_ops_for<Fix8Even32>();
+	check_constant_ops_for<Fix8Zero32>();
+	check_constant_ops_for<Fix31Even32Strict>();
+	check_constant_ops_for<Fix7Even16Sat>();
+	check_constant_ops_for<Fix3Even8Ignore>();
+
+	// a third rounds through the reciprocal path, ties go to even like operator/
+	EXPECT_EQ(fixmath::div_by<Fix32(3)>(Fix32(1)), Fix32(1) / Fix32(3));
+	EXPECT_EQ(fixmath::mul_by<Fix32(0.5)>(Fix32::from_raw(i64{3})).raw(), 2);
+	EXPECT_EQ(fixmath::mul_by<Fix32Zero(0.5)>(Fix32Zero::from_raw(i64{-3})).raw(), -1);
+	EXPECT_EQ(fixmath::div_by<Fix32(-1)>(Fix32::from_raw(i64l::min())), Fix32::max_sat());
+	static_assert(std::is_same_v<decltype(fixmath::mul_by<Fix32(2)>(1)), Fix32>);
+}
+
 TEST(FIXMATH, UNARY) {
 	EXPECT_FIX_NEAR(double(-Fix32(55554288)), -55554288);
 	EXPECT_FIX_NEAR(double(+Fix32(1.1111)), 1.1111);
@@ -962,6 +1261,759 @@ TEST(FIXMATH, SQRT_NARROW_UNDERLYING_TYPES) {
 	EXPECT_EQ(sqrt(Fix7Even16Ignore::from_raw(Fix7Even16Ignore::raw_t{-1})).raw(), 2048);
 }
 
+TEST(FIXMATH, FROM_STRING_GRAMMAR) {
+	for (const char* text : {"0", "+0", "-0", "123", "00123", "0.123", "-12.3400", "1e2", "1e+2", "1e-2", "-12.34e+005", "1E2", "-12.34E-5", "nan", "inf", "+inf", "-inf"}) {
+		Fix32 value;
+		EXPECT_TRUE(from_string(text, value)) << text;
+	}
+	for (const char* text : {"", ".123", "-.123", "1.", "1.e2", "e2", "1e", "1e+", " 1", "1 ", "1,25", "+nan", "-nan", "Infinity", "1e2147483648", "1e-2147483649"}) {
+		Fix32 value = Fix32(7);
+		EXPECT_FALSE(from_string(text, value)) << text;
+		EXPECT_EQ(value.raw(), Fix32(7).raw()) << text;
+	}
+}
+
+TEST(FIXMATH, FROM_STRING_VALUES) {
+	Fix32 value;
+	EXPECT_TRUE(from_string("1.5", value));
+	EXPECT_EQ(value.raw(), 3LL << 31);
+	EXPECT_TRUE(from_string("-12.34e+005", value));
+	EXPECT_EQ(value.raw(), -1234000LL << 32);
+	EXPECT_TRUE(from_string("-0", value));
+	EXPECT_EQ(value.raw(), 0);
+	EXPECT_TRUE(from_string("0.1234567890123456789012345", value));
+	EXPECT_EQ(value.raw(), 530242871);
+	EXPECT_TRUE(from_string("1e-2147483648", value));
+	EXPECT_EQ(value.raw(), 0);
+
+	Fix48Even64 pi48;
+	EXPECT_TRUE(from_string("-3.14159265358979323846264338327950288", pi48));
+	EXPECT_EQ(pi48.raw(), -884279719003555LL);
+
+	Fix32Strict strict;
+	EXPECT_TRUE(from_string("nan", strict));
+	EXPECT_TRUE(strict.is_nan());
+	EXPECT_TRUE(from_string("1e10", strict));
+	EXPECT_EQ(strict.raw(), Fix32Strict::inf().raw());
+	EXPECT_TRUE(from_string("-1e2147483647", strict));
+	EXPECT_EQ(strict.raw(), (-Fix32Strict::inf()).raw());
+}
+
+TEST(FIXMATH, FROM_STRING_ROUNDING) {
+	Fix8Even32 even;
+	Fix8Zero32 zero;
+	EXPECT_TRUE(from_string("0.1", even));
+	EXPECT_TRUE(from_string("0.1", zero));
+	EXPECT_EQ(even.raw(), 26);
+	EXPECT_EQ(zero.raw(), 25);
+
+	Fix3Even32 tie;
+	EXPECT_TRUE(from_string("0.0625", tie));
+	EXPECT_EQ(tie.raw(), 0);
+	EXPECT_TRUE(from_string("0.1875", tie));
+	EXPECT_EQ(tie.raw(), 2);
+	EXPECT_TRUE(from_string("0.06250000000000000000000000", tie));
+	EXPECT_EQ(tie.raw(), 0);
+	EXPECT_TRUE(from_string("0.06250000000000000000000001", tie));
+	EXPECT_EQ(tie.raw(), 1);
+
+	EXPECT_TRUE(from_string("8388607.99609375", even));
+	EXPECT_EQ(even.raw(), Fix8Even32::max_fix().raw());
+	EXPECT_TRUE(from_string("8388607.998", even));
+	EXPECT_EQ(even.raw(), Fix8Even32::inf().raw());
+	EXPECT_TRUE(from_string("8388607.998", zero));
+	EXPECT_EQ(zero.raw(), Fix8Zero32::max_fix().raw());
+}
+
+TEST(FIXMATH, CSV_COLUMNS) {
+	const std::string text = "id,price,qty\r\n1,1.5,-2\r\n2,oops,0.25\r\n3,2e1\r\n4,0.5,1\n";
+	const std::size_t fields[] = {2, 1};
+	for (std::size_t chunk_bytes : {std::size_t{1}, std::size_t{8}, std::size_t{1} << 22}) {
+		csv_columns<Fix32::policy> out;
+		parse_csv_columns<Fix32::policy>(text, fields, out, {.thread_count = 3, .chunk_bytes = chunk_bytes});
+		ASSERT_EQ(out.rows, 4u);
+		ASSERT_EQ(out.columns.size(), 2u);
+		EXPECT_EQ(out.columns[0], (std::vector<Fix32::raw_t>{Fix32(-2).raw(), Fix32(0.25).raw(), 0, Fix32(1).raw()}));
+		EXPECT_EQ(out.columns[1], (std::vector<Fix32::raw_t>{Fix32(1.5).raw(), 0, Fix32(20).raw(), Fix32(0.5).raw()}));
+		ASSERT_EQ(out.errors.size(), 2u);
+		EXPECT_EQ(out.errors[0].row, 1u);
+		EXPECT_EQ(out.errors[0].field, 1u);
+		EXPECT_EQ(out.errors[1].row, 2u);
+		EXPECT_EQ(out.errors[1].field, 2u);
+	}
+
+	// An empty view has a null data(); the previous result is still replaced.
+	for (const bool header : {true, false}) {
+		csv_columns<Fix32::policy> out;
+		parse_csv_columns<Fix32::policy>(text, fields, out);
+		parse_csv_columns<Fix32::policy>(std::string_view{}, fields, out, {.header = header});
+		EXPECT_EQ(out.rows, 0u);
+		EXPECT_EQ(out.columns, (std::vector<std::vector<Fix32::raw_t>>(2)));
+		EXPECT_TRUE(out.errors.empty());
+	}
+}
+
+TEST(FIXMATH, CSV_FILE) {
+	const std::string path = testing::TempDir() + "fixmath_csv_file.csv";
+	std::string text = "a;b\n";
+	for (int i = 0; i < 10000; ++i) {
+		text += std::to_string(i) + ";" + std::to_string(i) + ".5\n";
+	}
+	std::FILE* file = std::fopen(path.c_str(), "wb");
+	ASSERT_NE(file, nullptr);
+	std::fwrite(text.data(), 1, text.size(), file);
+	std::fclose(file);
+
+	const std::size_t fields[] = {1};
+	csv_columns<Fix16Even64::policy> out;
+	EXPECT_EQ(read_csv_columns<Fix16Even64::policy>(path.c_str(), fields, out, {.delimiter = ';', .thread_count = 4, .chunk_bytes = 4096}), std::errc{});
+	std::remove(path.c_str());
+	ASSERT_EQ(out.rows, 10000u);
+	EXPECT_TRUE(out.errors.empty());
+	for (int i = 0; i < 10000; ++i) {
+		ASSERT_EQ(out.columns[0][i], Fix16Even64(i + 0.5).raw());
+	}
+	EXPECT_EQ(read_csv_columns<Fix16Even64::policy>((path + ".missing").c_str(), fields, out), std::errc::no_such_file_or_directory);
+}
+
+TEST(FIXMATH, COLUMN_FILE) {
+	const std::string path = testing::TempDir() + "fixmath_column_file.bin";
+	std::vector<Fix32> prices;
+	std::vector<Fix32> quantities = {Fix32(1), Fix32(-2.5), Fix32::max_fix()};
+	for (int i = 0; i < 1000; ++i) {
+		prices.push_back(Fix32(i) / Fix32(7));
+	}
+	const std::span<const Fix32> columns[] = {prices, {}, quantities};
+	ASSERT_EQ(write_column_file<Fix32::policy>(path.c_str(), columns), std::errc{});
+
+	column_file<Fix32::policy> file;
+	ASSERT_EQ(file.open(path.c_str()), std::errc{});
+	ASSERT_EQ(file.column_count(), 3u);
+	EXPECT_TRUE(std::equal(prices.begin(), prices.end(), file.column(0).begin(), file.column(0).end()));
+	EXPECT_TRUE(file.column(1).empty());
+	EXPECT_TRUE(std::equal(quantities.begin(), quantities.end(), file.column(2).begin(), file.column(2).end()));
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(file.column(2).data()) % COLUMN_FILE_ALIGNMENT, 0u);
+	file.close();
+
+	column_file<Fix32Zero::policy> zero;
+	EXPECT_EQ(zero.open(path.c_str()), std::errc::invalid_argument);
+	column_file<Fix32Strict::policy> strict;
+	EXPECT_EQ(strict.open(path.c_str()), std::errc::invalid_argument);
+	column_file<Fix16Even64::policy> narrow;
+	EXPECT_EQ(narrow.open(path.c_str()), std::errc::invalid_argument);
+	EXPECT_EQ(narrow.column_count(), 0u);
+
+	std::FILE* bad_magic = std::fopen(path.c_str(), "r+b");
+	ASSERT_NE(bad_magic, nullptr);
+	std::fputc('X', bad_magic);
+	std::fclose(bad_magic);
+	EXPECT_EQ(file.open(path.c_str()), std::errc::illegal_byte_sequence);
+
+	// A file that ends right after the header, before its directory, and one a byte short of it.
+	ASSERT_EQ(write_column_file<Fix32::policy>(path.c_str(), columns), std::errc{});
+	std::vector<char> data(sizeof(column_file_header));
+	std::FILE* original = std::fopen(path.c_str(), "rb");
+	ASSERT_NE(original, nullptr);
+	ASSERT_EQ(std::fread(data.data(), 1, data.size(), original), data.size());
+	std::fclose(original);
+	for (const std::size_t size : {sizeof(column_file_header), sizeof(column_file_header) - 1}) {
+		data.resize(size);
+		std::FILE* truncated = std::fopen(path.c_str(), "wb");
+		ASSERT_NE(truncated, nullptr);
+		std::fwrite(data.data(), 1, data.size(), truncated);
+		std::fclose(truncated);
+		EXPECT_EQ(file.open(path.c_str()), std::errc::illegal_byte_sequence) << size;
+		EXPECT_EQ(file.column_count(), 0u);
+	}
+	std::remove(path.c_str());
+	EXPECT_EQ(file.open(path.c_str()), std::errc::no_such_file_or_directory);
+}
+
+TEST(FIXMATH, PARALLEL_REDUCE) {
+	std::uniform_int_distribution<Fix32::raw_t> dist(-(Fix32::raw_t{1} << 40), Fix32::raw_t{1} << 40);
+	std::vector<Fix32> values(100003);
+	for (Fix32& value : values) {
+		value = Fix32::from_raw(dist(mtg));
+	}
+	Fix32 serial = 0;
+	for (const Fix32 value : values) {
+		serial = serial + value;
+	}
+	for (unsigned threads : {1u, 2u, 3u, 8u}) {
+		for (std::size_t grain : {std::size_t{1}, std::size_t{4097}, std::size_t{1} << 16}) {
+			const parallel::reduction<Fix32::policy> sum = parallel::reduce<Fix32::policy>(values, {threads, grain});
+			EXPECT_EQ(sum.value.raw(), serial.raw());
+			EXPECT_FALSE(sum.overflow);
+			EXPECT_FALSE(sum.partial_overflow);
+		}
+	}
+
+	const Fix8Even32 saturating[] = {Fix8Even32::max_fix(), Fix8Even32::epsilon(), -Fix8Even32::epsilon()};
+	const parallel::reduction<Fix8Even32::policy> partial = parallel::reduce<Fix8Even32::policy>(saturating, {2, 1});
+	EXPECT_EQ(partial.value.raw(), Fix8Even32::max_fix().raw());
+	EXPECT_FALSE(partial.overflow);
+	EXPECT_TRUE(partial.partial_overflow);
+
+	const Fix8Even32 overflowing[] = {Fix8Even32::min_fix(), -Fix8Even32::epsilon()};
+	const parallel::reduction<Fix8Even32::policy> low = parallel::reduce<Fix8Even32::policy>(overflowing);
+	EXPECT_EQ(low.value.raw(), Fix8Even32::min_sat().raw());
+	EXPECT_TRUE(low.overflow);
+
+	using Fix8Ignore32 = TestFix<fixmath::int32_t, 8, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
+	const Fix8Ignore32 wrapping[] = {Fix8Ignore32::max_fix(), Fix8Ignore32::max_fix(), Fix8Ignore32::epsilon()};
+	const parallel::reduction<Fix8Ignore32::policy> wrapped = parallel::reduce<Fix8Ignore32::policy>(wrapping, {3, 1});
+	EXPECT_EQ(wrapped.value.raw(), (wrapping[0] + wrapping[1] + wrapping[2]).raw());
+	EXPECT_TRUE(wrapped.overflow);
+	EXPECT_FALSE(wrapped.partial_overflow);
+
+	const Fix32Strict specials[] = {Fix32Strict(1), Fix32Strict::inf(), Fix32Strict(2)};
+	EXPECT_EQ(parallel::reduce<Fix32Strict::policy>(specials).value.raw(), Fix32Strict::inf().raw());
+	const Fix32Strict opposite[] = {-Fix32Strict::inf(), Fix32Strict(1), Fix32Strict::inf()};
+	EXPECT_TRUE(parallel::reduce<Fix32Strict::policy>(opposite, {2, 1}).value.is_nan());
+
+	EXPECT_EQ(parallel::min<Fix32::policy>(values, {4, 1000}).raw(), std::min_element(values.begin(), values.end())->raw());
+	EXPECT_EQ(parallel::max<Fix32::policy>(values, {4, 1000}).raw(), std::max_element(values.begin(), values.end())->raw());
+	const Fix32Strict with_nan[] = {Fix32Strict(1), Fix32Strict::nan(), Fix32Strict(-1)};
+	EXPECT_TRUE(parallel::max<Fix32Strict::policy>(with_nan, {2, 1}).is_nan());
+}
+
+TEST(FIXMATH, PARALLEL_DOT) {
+	std::uniform_int_distribution<Fix32::raw_t> dist(-(Fix32::raw_t{1} << 36), Fix32::raw_t{1} << 36);
+	std::vector<Fix32> a(50000);
+	std::vector<Fix32> b(a.size());
+	fixmath::_fm_int192 exact = {};
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a[i] = Fix32::from_raw(dist(mtg));
+		b[i] = Fix32::from_raw(dist(mtg));
+		Fix32::raw_t product_hi = 0;
+		const Fix32::raw_t product_lo = fixmath::_fm_mul128(a[i].raw(), b[i].raw(), product_hi);
+		fixmath::_fm_add(exact, product_hi, static_cast<u64>(product_lo));
+	}
+	bool overflow = false;
+	const Fix32::raw_t expected = fixmath::_fm_narrow192<Fix32::policy>(exact, Fix32::FRACTION_BITS, overflow);
+	EXPECT_FALSE(overflow);
+	for (unsigned threads : {1u, 3u, 8u}) {
+		const parallel::reduction<Fix32::policy> dot = parallel::dot<Fix32::policy>(a, b, {threads, 1000});
+		EXPECT_EQ(dot.value.raw(), expected);
+		EXPECT_FALSE(dot.overflow);
+	}
+
+	const Fix8Zero32 x[] = {Fix8Zero32::from_raw(3), Fix8Zero32::from_raw(-5)};
+	const Fix8Zero32 y[] = {Fix8Zero32::from_raw(1000), Fix8Zero32::from_raw(1000)};
+	EXPECT_EQ(parallel::dot<Fix8Zero32::policy>(x, y).value.raw(), -7);
+	const Fix8Even32 big[] = {Fix8Even32(30000), Fix8Even32(30000)};
+	const parallel::reduction<Fix8Even32::policy> saturated = parallel::dot<Fix8Even32::policy>(big, big);
+	EXPECT_TRUE(saturated.overflow);
+	EXPECT_EQ(saturated.value.raw(), Fix8Even32::max_sat().raw());
+}
+
+// A raw of random magnitude, so that small, in-range, and overflowing results are all common.
+template <class Fix>
+Fix random_fix() {
+	using raw_t = typename Fix::raw_t;
+	std::uniform_int_distribution<raw_t> dist(std::numeric_limits<raw_t>::min(), std::numeric_limits<raw_t>::max());
+	std::uniform_int_distribution<int> shift(0, static_cast<int>(sizeof(raw_t) * 8 - 1));
+	return Fix::from_raw(static_cast<raw_t>(dist(mtg) >> shift(mtg)));
+}
+
+// Random operands, with every pair of edge values at the front.
+template <class Fix, std::size_t N>
+void fill_operands(std::vector<Fix>& a, std::vector<Fix>& b, const Fix (&edges)[N]) {
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a[i] = random_fix<Fix>();
+		b[i] = random_fix<Fix>();
+	}
+	for (std::size_t i = 0; i < N; ++i) {
+		for (std::size_t j = 0; j < N; ++j) {
+			a[i * N + j] = edges[i];
+			b[i * N + j] = edges[j];
+		}
+	}
+}
+
+template <class Fix>
+auto raw_bits(Fix x) {
+	return x.raw();
+}
+
+template <class Fix>
+auto raw_bits(complex<Fix> x) {
+	return std::pair{x.re.raw(), x.im.raw()};
+}
+
+// Runs a batch kernel into a separate output and in place over a, and compares every element
+// with the scalar operation on the same operands. Raws are compared, so that nan matches nan.
+template <class T, class Kernel, class Scalar>
+void check_batch_matches_scalar(const std::vector<T>& a, const std::vector<T>& b, Kernel kernel, Scalar scalar) {
+	std::vector<T> expected(a.size());
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		expected[i] = scalar(a[i], b[i]);
+	}
+	std::vector<T> out(a.size());
+	kernel(a, b, out);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(raw_bits(out[i]), raw_bits(expected[i])) << i;
+	}
+	out = a;
+	kernel(out, b, out);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(raw_bits(out[i]), raw_bits(expected[i])) << "in place " << i;
+	}
+}
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+template <class Fix>
+void check_extreme_kernels_agree() {
+	using policy = typename Fix::policy;
+	using raw_t = typename Fix::raw_t;
+	std::vector<Fix> values(1000);
+	for (Fix& value : values) {
+		value = random_fix<Fix>();
+	}
+	for (std::size_t count : {std::size_t{1}, std::size_t{15}, std::size_t{16}, std::size_t{17}, std::size_t{999}}) {
+		bool nan = false;
+		bool expected_nan = false;
+		const raw_t largest = fixmath::_fm_extreme_block_avx512<policy, true>(values.data(), count, nan);
+		const raw_t smallest = fixmath::_fm_extreme_block_avx512<policy, false>(values.data(), count, nan);
+		EXPECT_EQ(largest, (fixmath::_fm_extreme_block<policy, true>(values.data(), count, expected_nan)));
+		EXPECT_EQ(smallest, (fixmath::_fm_extreme_block<policy, false>(values.data(), count, expected_nan)));
+		EXPECT_EQ(nan, expected_nan);
+	}
+}
+#endif
+
+TEST(FIXMATH, PARALLEL_DISPATCH) {
+	// The split accumulation of 64-bit dot products against one 192-bit add per product.
+	std::uniform_int_distribution<Fix32::raw_t> dist(i64l::min(), i64l::max());
+	std::vector<Fix32> a(5000);
+	std::vector<Fix32> b(a.size());
+	fixmath::_fm_int192 expected = {};
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a[i] = Fix32::from_raw(dist(mtg));
+		b[i] = Fix32::from_raw(dist(mtg));
+		Fix32::raw_t product_hi = 0;
+		const Fix32::raw_t product_lo = fixmath::_fm_mul128(a[i].raw(), b[i].raw(), product_hi);
+		fixmath::_fm_add(expected, product_hi, static_cast<u64>(product_lo));
+	}
+	const fixmath::_fm_reduce_part part = fixmath::_fm_reduce_dot<Fix32::policy>(a.data(), b.data(), a.size());
+	EXPECT_EQ(part.sum.limb[0], expected.limb[0]);
+	EXPECT_EQ(part.sum.limb[1], expected.limb[1]);
+	EXPECT_EQ(part.sum.limb[2], expected.limb[2]);
+
+#if FIXMATH_USE_RUNTIME_DISPATCH
+	if (!fixmath::_fm_cpu().avx512f) {
+		GTEST_SKIP() << "no AVX-512F";
+	}
+	check_extreme_kernels_agree<Fix32>();
+	check_extreme_kernels_agree<Fix32Strict>();
+	check_extreme_kernels_agree<Fix8Even32>();
+	std::vector<Fix32Strict> with_nan(100, Fix32Strict(1));
+	with_nan[97] = Fix32Strict::nan();
+	bool nan = false;
+	fixmath::_fm_extreme_block_avx512<Fix32Strict::policy, true>(with_nan.data(), with_nan.size(), nan);
+	EXPECT_TRUE(nan);
+#endif
+}
+
+template <class Fix>
+void check_multiply_matches_operator() {
+	using policy = typename Fix::policy;
+	using raw_t = typename Fix::raw_t;
+	std::vector<Fix> a(4099);
+	std::vector<Fix> b(a.size());
+	const Fix edges[] = {Fix(0), Fix(1), Fix(-1), Fix::epsilon(), -Fix::epsilon(), Fix::max_fix(), Fix::min_fix(), Fix::max_sat(), Fix::min_sat(), Fix::nan()};
+	fill_operands(a, b, edges);
+	// Products of odd multiples of 2^(F/2) end in exactly half a unit.
+	a[200] = Fix::from_raw(static_cast<raw_t>(raw_t{3} << (Fix::FRACTION_BITS / 2)));
+	b[200] = Fix::from_raw(static_cast<raw_t>(raw_t{5} << (Fix::FRACTION_BITS - Fix::FRACTION_BITS / 2 - 1)));
+	a[201] = -a[200];
+	b[201] = b[200];
+	for (const parallel::options opts : {parallel::options{1, 1000}, parallel::options{3, 7}}) {
+		check_batch_matches_scalar(a, b, [&](const auto& x, const auto& y, auto& out) { parallel::multiply<policy>(x, y, out, opts); }, std::multiplies<>{});
+	}
+}
+
+TEST(FIXMATH, PARALLEL_MULTIPLY) {
+	check_multiply_matches_operator<Fix32>();
+	check_multiply_matches_operator<Fix32Zero>();
+	check_multiply_matches_operator<Fix32Ignore>();
+	check_multiply_matches_operator<Fix32Strict>();
+	check_multiply_matches_operator<Fix16Even64>();
+	check_multiply_matches_operator<Fix48Even64>();
+	check_multiply_matches_operator<Fix8Even32>();
+}
+
+template <class Fix>
+void check_add_matches_operator() {
+	using policy = typename Fix::policy;
+	std::vector<Fix> a(4099);
+	std::vector<Fix> b(a.size());
+	const Fix edges[] = {Fix(0), Fix::epsilon(), -Fix::epsilon(), Fix::max_fix(), Fix::min_fix(), Fix::max_sat(), Fix::min_sat(), Fix::nan()};
+	fill_operands(a, b, edges);
+	check_batch_matches_scalar(a, b, [](const auto& x, const auto& y, auto& out) { parallel::add<policy>(x, y, out, parallel::options{3, 1000}); }, std::plus<>{});
+}
+
+TEST(FIXMATH, PARALLEL_NARROW_SIMD) {
+	check_multiply_matches_operator<Fix8Even16Sat>();
+	check_multiply_matches_operator<Fix8Zero16Sat>();
+	check_multiply_matches_operator<Fix15Even16Sat>();
+	check_multiply_matches_operator<Fix15Zero16Sat>();
+	check_multiply_matches_operator<Fix15Even16Ignore>();
+	check_multiply_matches_operator<Fix15Even16Strict>();
+	check_multiply_matches_operator<Fix7Even16Ignore>();
+	check_multiply_matches_operator<Fix16Even32Sat>();
+	check_multiply_matches_operator<Fix16Zero32Sat>();
+	check_multiply_matches_operator<Fix16Even32Ignore>();
+	check_multiply_matches_operator<Fix31Even32Sat>();
+	check_multiply_matches_operator<Fix31Zero32Ignore>();
+
+	check_add_matches_operator<Fix8Even16Sat>();
+	check_add_matches_operator<Fix15Even16Ignore>();
+	check_add_matches_operator<Fix15Even16Strict>();
+	check_add_matches_operator<Fix16Even32Sat>();
+	check_add_matches_operator<Fix16Even32Ignore>();
+	check_add_matches_operator<Fix31Zero32Sat>();
+
+	// Every Q1.15 value against factors whose products end in exactly half a unit for many of them.
+	for (const std::int16_t factor : {std::int16_t{1}, std::int16_t{3}, std::int16_t{-3}, std::int16_t{0x4000}, std::int16_t{-0x4000}, std::int16_t{0x7fff}, std::int16_t{-0x8000}}) {
+		std::vector<Fix15Even16Sat> a(65536);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			a[i] = Fix15Even16Sat::from_raw(static_cast<std::int16_t>(i));
+		}
+		const std::vector<Fix15Even16Sat> b(a.size(), Fix15Even16Sat::from_raw(factor));
+		std::vector<Fix15Even16Sat> out(a.size());
+		parallel::multiply<Fix15Even16Sat::policy>(a, b, out);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			ASSERT_EQ(out[i].raw(), (a[i] * b[i]).raw()) << a[i].raw() << " * " << factor;
+		}
+	}
+}
+
+template <class Fix>
+void check_divide_matches_operator() {
+	using policy = typename Fix::policy;
+	using raw_t = typename Fix::raw_t;
+	std::vector<Fix> a(4099);
+	std::vector<Fix> b(a.size());
+	const Fix edges[] = {Fix(0), Fix(1), Fix(-1), Fix::epsilon(), -Fix::epsilon(), Fix::max_fix(), Fix::min_fix(), Fix::max_sat(), Fix::min_sat()};
+	fill_operands(a, b, edges);
+	// no zero divisors: operator/ reports them through FIXMATH_ERROR
+	for (Fix& divisor : b) {
+		if (divisor.raw() == 0) {
+			divisor = Fix::max_fix();
+		}
+	}
+	// odd multiples of epsilon over 2.0 end in exactly half a unit
+	for (std::size_t i = 100; i < 164; ++i) {
+		a[i] = Fix::from_raw(static_cast<raw_t>((i % 2 ? 1 : -1) * static_cast<raw_t>(2 * i + 1)));
+		b[i] = Fix(2);
+	}
+	check_batch_matches_scalar(a, b, [](const auto& x, const auto& y, auto& out) { parallel::divide<policy>(x, y, out, parallel::options{3, 1000}); }, std::divides<>{});
+}
+
+TEST(FIXMATH, PARALLEL_DIVIDE) {
+	check_divide_matches_operator<Fix16Even32Sat>();
+	check_divide_matches_operator<Fix16Zero32Sat>();
+	check_divide_matches_operator<Fix16Even32Ignore>();
+	check_divide_matches_operator<Fix31Even32Sat>();
+	check_divide_matches_operator<Fix31Zero32Ignore>();
+	check_divide_matches_operator<Fix31Even32Strict>();
+	check_divide_matches_operator<Fix3Even32>();
+	check_divide_matches_operator<Fix8Even16Sat>();
+	check_divide_matches_operator<Fix32>();
+}
+
+template <class Fix>
+void check_scans_match_serial(const std::vector<Fix>& values, Fix init) {
+	std::vector<Fix> inclusive(values.size());
+	std::vector<Fix> exclusive(values.size());
+	std::size_t first_overflow = values.size();
+	Fix acc = 0;
+	Fix exclusive_acc = init;
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		bool overflow = false;
+		const auto raw = _fm_checked_add(acc.raw(), values[i].raw(), overflow);
+		const bool special = acc.is_nan() || acc.is_inf() || values[i].is_nan() || values[i].is_inf();
+		if (!Fix::policy::ignore_mode && first_overflow == values.size() && !special && (overflow || raw > Fix::max_fix().raw() || raw < Fix::min_fix().raw())) {
+			first_overflow = i;
+		}
+		acc = acc + values[i];
+		inclusive[i] = acc;
+		exclusive[i] = exclusive_acc;
+		exclusive_acc = exclusive_acc + values[i];
+	}
+	const auto raws = [](const std::vector<Fix>& v) {
+		std::vector<typename Fix::raw_t> result;
+		for (const Fix x : v) {
+			result.push_back(x.raw());
+		}
+		return result;
+	};
+	for (unsigned threads : {1u, 3u}) {
+		for (std::size_t grain : {std::size_t{5}, std::size_t{1000}}) {
+			std::vector<Fix> out(values.size());
+			EXPECT_EQ(parallel::inclusive_scan<typename Fix::policy>(values, out, {threads, grain}), first_overflow);
+			EXPECT_EQ(raws(out), raws(inclusive));
+			EXPECT_EQ(parallel::exclusive_scan<typename Fix::policy>(values, out, init, {threads, grain}), init.is_nan() ? values.size() : first_overflow);
+			EXPECT_EQ(raws(out), raws(exclusive));
+			std::vector<Fix> in_place = values;
+			parallel::inclusive_scan<typename Fix::policy>(in_place, in_place, {threads, grain});
+			EXPECT_EQ(raws(in_place), raws(inclusive));
+			in_place = values;
+			parallel::exclusive_scan<typename Fix::policy>(in_place, in_place, init, {threads, grain});
+			EXPECT_EQ(raws(in_place), raws(exclusive));
+		}
+	}
+}
+
+TEST(FIXMATH, PARALLEL_SCAN) {
+	std::uniform_int_distribution<Fix32::raw_t> dist(-(Fix32::raw_t{1} << 50), Fix32::raw_t{1} << 50);
+	std::vector<Fix32> values(4099);
+	for (Fix32& value : values) {
+		value = Fix32::from_raw(dist(mtg));
+	}
+	check_scans_match_serial(values, Fix32(3));
+	values[2000] = Fix32::max_fix();
+	values[2001] = Fix32::max_fix();
+	values[3000] = Fix32::min_fix();
+	check_scans_match_serial(values, Fix32(3));
+
+	std::vector<Fix32Ignore> wrapping(values.size());
+	std::vector<Fix32Strict> strict(values.size());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		wrapping[i] = Fix32Ignore::from_raw(values[i].raw());
+		strict[i] = Fix32Strict::from_raw(std::max(values[i].raw(), Fix32Strict::min_fix().raw()));
+	}
+	check_scans_match_serial(wrapping, Fix32Ignore(0));
+	check_scans_match_serial(strict, Fix32Strict(1));
+	strict[10] = Fix32Strict::nan();
+	check_scans_match_serial(strict, Fix32Strict(1));
+	check_scans_match_serial(std::vector<Fix32Strict>(9, Fix32Strict(1)), Fix32Strict::nan());
+
+	std::vector<Fix8Even32> narrow(3000, Fix8Even32(1000));
+	narrow[1500] = Fix8Even32::min_fix();
+	check_scans_match_serial(narrow, Fix8Even32(0));
+}
+
+// Direct-form reference: every output is the exact sum of products, rounded once.
+template <class Fix, class Coefficient>
+std::vector<Fix> fir_reference(const std::vector<Coefficient>& taps, const std::vector<Fix>& in) {
+	std::vector<Fix> out(in.size());
+	for (std::size_t n = 0; n < in.size(); ++n) {
+		_fm_int192 sum = {};
+		for (std::size_t k = 0; k < taps.size() && k <= n; ++k) {
+			_fm_accumulate_product<false>(sum, taps[k].raw(), in[n - k].raw());
+		}
+		bool overflow = false;
+		out[n] = Fix::from_raw(_fm_narrow192<typename Fix::policy>(sum, static_cast<int>(Coefficient::FRACTION_BITS), overflow));
+	}
+	return out;
+}
+
+template <class Fix, class Coefficient = Fix>
+void check_fir_matches_reference(std::size_t tap_count, bool full_scale) {
+	using raw_t = typename Fix::raw_t;
+	using coefficient_raw_t = typename Coefficient::raw_t;
+	std::vector<Coefficient> taps(tap_count);
+	for (Coefficient& tap : taps) {
+		tap = Coefficient::from_raw(static_cast<coefficient_raw_t>(mtg()));
+	}
+	if (full_scale && tap_count != 0) {
+		taps[tap_count / 2] = Coefficient::from_raw(std::numeric_limits<coefficient_raw_t>::min());
+	}
+	std::vector<Fix> in(5000);
+	for (Fix& x : in) {
+		x = Fix::from_raw(static_cast<raw_t>(mtg()));
+	}
+	const std::vector<Fix> expected = fir_reference(taps, in);
+	for (const std::size_t chunk : {std::size_t{1}, std::size_t{7}, in.size()}) {
+		fir_filter<typename Fix::policy, typename Coefficient::policy> filter(taps);
+		std::vector<Fix> out(in);
+		for (std::size_t first = 0; first < out.size(); first += chunk) {
+			const std::size_t size = std::min(chunk, out.size() - first);
+			// In place: the filter must read each block before writing it.
+			filter.process(std::span<const Fix>(out.data() + first, size), std::span<Fix>(out.data() + first, size));
+		}
+		for (std::size_t n = 0; n < in.size(); ++n) {
+			ASSERT_EQ(out[n].raw(), expected[n].raw()) << "taps " << tap_count << " chunk " << chunk << " sample " << n;
+		}
+	}
+}
+
+TEST(FIXMATH, FIR_FILTER) {
+	using Q15 = Fix15Even16Sat;
+	const Q15 taps[] = {Q15(0.25), Q15(0.5), Q15(0.25)};
+	fir_filter<Q15::policy> filter(taps);
+	EXPECT_EQ(filter.tap_count(), 3u);
+	EXPECT_EQ(filter.process(Q15(0.5)), Q15(0.125));
+	EXPECT_EQ(filter.process(Q15(0)), Q15(0.25));
+	EXPECT_EQ(filter.process(Q15(0)), Q15(0.125));
+	EXPECT_EQ(filter.process(Q15(0)), Q15(0));
+	filter.process(Q15(0.5));
+	filter.reset();
+	EXPECT_EQ(filter.process(Q15(0)), Q15(0));
+
+	// The sum of three full-scale products saturates once instead of wrapping.
+	const Q15 ones[] = {Q15(-1), Q15(-1), Q15(-1)};
+	fir_filter<Q15::policy> saturating(ones);
+	saturating.process(Q15(-1));
+	saturating.process(Q15(-1));
+	EXPECT_EQ(saturating.process(Q15(-1)), Q15::max_fix());
+
+	fir_filter<Q15::policy> empty;
+	EXPECT_EQ(empty.process(Q15(0.5)), Q15(0));
+
+	for (const std::size_t tap_count : {std::size_t{1}, std::size_t{5}, std::size_t{16}, std::size_t{37}, std::size_t{64}}) {
+		check_fir_matches_reference<Fix15Even16Sat>(tap_count, false);
+		check_fir_matches_reference<Fix15Even16Sat>(tap_count, true);
+		check_fir_matches_reference<Fix15Zero16Sat>(tap_count, false);
+		check_fir_matches_reference<Fix15Even16Ignore>(tap_count, false);
+		check_fir_matches_reference<Fix16Even32Sat>(tap_count, true);
+		check_fir_matches_reference<Fix16Even32Ignore>(tap_count, false);
+		check_fir_matches_reference<Fix31Zero32Sat>(tap_count, true);
+		check_fir_matches_reference<Fix32>(tap_count, true);
+		check_fir_matches_reference<Fix16Even32Sat, Fix15Even16Sat>(tap_count, false);
+		check_fir_matches_reference<Fix32, Fix31Zero32Sat>(tap_count, false);
+	}
+}
+
+TEST(FIXMATH, BIQUAD) {
+	using Q15 = Fix15Even16Sat;
+	// Without feedback, a biquad is a 3-tap FIR filter.
+	std::vector<Q15> in(1000);
+	for (Q15& x : in) {
+		x = Q15::from_raw(static_cast<std::int16_t>(mtg()));
+	}
+	const std::vector<Q15> taps = {Q15(0.3), Q15(-0.6), Q15(0.3)};
+	biquad<Q15::policy> feedforward(taps[0], taps[1], taps[2], Q15(0), Q15(0));
+	std::vector<Q15> out(in.size());
+	feedforward.process(in, out);
+	const std::vector<Q15> expected = fir_reference(taps, in);
+	for (std::size_t n = 0; n < in.size(); ++n) {
+		ASSERT_EQ(out[n].raw(), expected[n].raw()) << n;
+	}
+
+	// A one-pole low-pass y = x / 2 + y / 2 in Q16.16 samples with Q2.30 coefficients.
+	using Coefficient = TestFix<int32_t, 30, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+	biquad<Fix16Even32Sat::policy, Coefficient::policy> low_pass(Coefficient(0.5), Coefficient(0), Coefficient(0), Coefficient(-0.5), Coefficient(0));
+	double y = 0;
+	for (int n = 0; n < 40; ++n) {
+		y = 0.5 + y / 2;
+		EXPECT_NEAR(static_cast<double>(low_pass.process(Fix16Even32Sat(1))), y, 1.0 / 65536) << n;
+	}
+	low_pass.reset();
+	EXPECT_EQ(low_pass.process(Fix16Even32Sat(1)), Fix16Even32Sat(0.5));
+}
+
+// Compares fft and ifft with a long double DFT, in units of the result's 2^exponent. The
+// allowed error is max_ulp plus relative times the largest reference magnitude.
+template <class Fix, std::size_t N, fft_radix radix>
+void check_fft_matches_dft(int input_bits, double max_ulp, double relative = 0) {
+	using raw_t = typename Fix::raw_t;
+	std::vector<Fix> real(N);
+	std::vector<Fix> imag(N);
+	std::vector<long double> x_real(N);
+	std::vector<long double> x_imag(N);
+	for (std::size_t n = 0; n < N; ++n) {
+		real[n] = Fix::from_raw(static_cast<raw_t>(static_cast<i64>(mtg()) >> (64 - input_bits)));
+		imag[n] = Fix::from_raw(static_cast<raw_t>(static_cast<i64>(mtg()) >> (64 - input_bits)));
+		x_real[n] = real[n].raw();
+		x_imag[n] = imag[n].raw();
+	}
+	const int exponent = fft<radix>(std::span<Fix, N>(real), std::span<Fix, N>(imag));
+	const long double two_pi = 2 * std::acos(-1.0L);
+	std::vector<long double> dft_real(N);
+	std::vector<long double> dft_imag(N);
+	long double largest = 0;
+	for (std::size_t k = 0; k < N; ++k) {
+		for (std::size_t n = 0; n < N; ++n) {
+			const long double angle = -two_pi * static_cast<long double>(n * k % N) / N;
+			dft_real[k] += x_real[n] * std::cos(angle) - x_imag[n] * std::sin(angle);
+			dft_imag[k] += x_real[n] * std::sin(angle) + x_imag[n] * std::cos(angle);
+		}
+		largest = std::max({largest, std::fabs(dft_real[k]), std::fabs(dft_imag[k])});
+	}
+	const long double tolerance = max_ulp + std::ldexp(relative * largest, -exponent);
+	for (std::size_t k = 0; k < N; ++k) {
+		ASSERT_LE(std::fabs(std::ldexp(dft_real[k], -exponent) - real[k].raw()), tolerance) << "N " << N << " bin " << k;
+		ASSERT_LE(std::fabs(std::ldexp(dft_imag[k], -exponent) - imag[k].raw()), tolerance) << "N " << N << " bin " << k;
+	}
+	const int round_trip = exponent + ifft<radix>(std::span<Fix, N>(real), std::span<Fix, N>(imag));
+	// The inverse adds its own rounding, but the round trip stays within the forward error.
+	const long double round_trip_tolerance = std::ldexp(tolerance, exponent);
+	for (std::size_t n = 0; n < N; ++n) {
+		ASSERT_LE(std::fabs(x_real[n] - std::ldexp(static_cast<long double>(real[n].raw()), round_trip)), round_trip_tolerance) << "N " << N << " sample " << n;
+		ASSERT_LE(std::fabs(x_imag[n] - std::ldexp(static_cast<long double>(imag[n].raw()), round_trip)), round_trip_tolerance) << "N " << N << " sample " << n;
+	}
+}
+
+TEST(FIXMATH, FFT_TWIDDLES) {
+	static_assert(_fm_sincos<precision::Precise, Fix32::policy>(0, true) == (i64{1} << 32));
+	// Radix-2 tables hold W^j for the spans 1, 2, and 4 one after another.
+	constexpr auto& table = _fm_fft_twiddle_table<fixmath::int64_t, 8, fft_radix::Radix2>;
+	static_assert(std::size(table.cos) == 7);
+	static_assert(table.cos[0] == (i64{1} << 32) && table.sin[0] == 0);
+	static_assert(table.cos[2] == 0 && table.sin[2] == (i64{1} << 32));
+	static_assert(table.cos[4] == table.sin[4] && table.cos[6] == -table.cos[4]);
+	EXPECT_NEAR(static_cast<double>(table.cos[4]), std::ldexp(std::sqrt(0.5), 32), 1);
+
+	constexpr auto& q31 = _fm_fft_twiddle_table<i32, 1024, fft_radix::Radix4>;
+	static_assert(q31.cos[0] == std::numeric_limits<i32>::max());
+	for (std::size_t j = 0; j < 256; ++j) {
+		// The last radix-4 stage: W^j, W^2j, and W^3j for W = e^(-2 pi i / 1024).
+		const std::size_t offset = std::size(q31.cos) - 3 * 256;
+		for (std::size_t power = 1; power <= 3; ++power) {
+			const double angle = 2 * pi * static_cast<double>(power * j) / 1024;
+			EXPECT_NEAR(q31.cos[offset + (power == 1 ? 0 : power == 2 ? 256 : 512) + j], std::ldexp(std::cos(angle), 31), 1.5) << j;
+			EXPECT_NEAR(q31.sin[offset + (power == 1 ? 0 : power == 2 ? 256 : 512) + j], std::ldexp(std::sin(angle), 31), 1.5) << j;
+		}
+	}
+}
+
+TEST(FIXMATH, FFT) {
+	using Q31 = TestFix<int32_t, 31, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+	using Q31Zero = TestFix<int32_t, 31, arithmetic_mode::SaturationMode, rounding_mode::RoundToZero>;
+	using Q31Ignore = TestFix<int32_t, 31, arithmetic_mode::Ignore, rounding_mode::RoundToEven>;
+	check_fft_matches_dft<Q31, 4, fft_radix::Radix4>(32, 2);
+	check_fft_matches_dft<Q31, 8, fft_radix::Radix4>(32, 3);
+	check_fft_matches_dft<Q31, 64, fft_radix::Radix2>(32, 8);
+	check_fft_matches_dft<Q31, 64, fft_radix::Radix4>(32, 8);
+	check_fft_matches_dft<Q31, 128, fft_radix::Radix4>(32, 8);
+	// Small inputs are not scaled, so the rounding errors of every stage add up in raw units.
+	check_fft_matches_dft<Q31, 256, fft_radix::Radix4>(20, 24);
+	check_fft_matches_dft<Q31Zero, 64, fft_radix::Radix4>(32, 12);
+	check_fft_matches_dft<Q31Ignore, 32, fft_radix::Radix2>(32, 8);
+	// Q32.32 twiddles have 32 fraction bits, which bounds the error of 64-bit raws relative
+	// to the largest output, at about 2^-32 of it.
+	check_fft_matches_dft<Fix32, 64, fft_radix::Radix2>(34, 4, 0x1p-30);
+	check_fft_matches_dft<Fix32, 256, fft_radix::Radix4>(34, 4, 0x1p-30);
+	check_fft_matches_dft<Fix32Ignore, 512, fft_radix::Radix4>(60, 4, 0x1p-30);
+
+	// A full-scale impulse needs no twiddle products, so its flat spectrum is exact.
+	std::vector<Q31> real(16, Q31(0));
+	std::vector<Q31> imag(16, Q31(0));
+	real[0] = Q31::min_fix();
+	const int exponent = fft(std::span<Q31, 16>(real), std::span<Q31, 16>(imag));
+	for (std::size_t k = 0; k < 16; ++k) {
+		EXPECT_EQ(std::ldexp(static_cast<double>(real[k].raw()), exponent), -std::ldexp(1.0, 31)) << k;
+		EXPECT_EQ(imag[k].raw(), 0) << k;
+	}
+
+	// A small tone in bin 3 is scaled once, before the last stage.
+	std::vector<Q31> tone_real(64);
+	std::vector<Q31> tone_imag(64);
+	for (std::size_t n = 0; n < 64; ++n) {
+		tone_real[n] = Q31(0.01 * std::cos(2 * pi * 3 * static_cast<double>(n) / 64));
+		tone_imag[n] = Q31(0.01 * std::sin(2 * pi * 3 * static_cast<double>(n) / 64));
+	}
+	const int tone_exponent = fft(std::span<Q31, 64>(tone_real), std::span<Q31, 64>(tone_imag));
+	EXPECT_EQ(tone_exponent, 1);
+	for (std::size_t k = 0; k < 64; ++k) {
+		EXPECT_NEAR(std::ldexp(static_cast<double>(tone_real[k]), tone_exponent), k == 3 ? 0.64 : 0.0, 1e-8) << k;
+		EXPECT_NEAR(std::ldexp(static_cast<double>(tone_imag[k]), tone_exponent), 0.0, 1e-8) << k;
+	}
+}
+
 template <class T, class U>
 	requires FixedImplicitBinaryOperable<T, U>
 constexpr int func(T, U) {
@@ -974,6 +2026,721 @@ constexpr int func(T, U) {
 	return 2;
 }
 
+// checked_ ops must return the operator's value in both modes, and raise Overflow exactly
+// when the saturating and the wrapping operator disagree.
+template <class Raw, Raw FractionBits, rounding_mode RoundingMode>
+void check_checked_ops_match_operators() {
+	using Sat = TestFix<Raw, FractionBits, arithmetic_mode::SaturationMode, RoundingMode>;
+	using Wrap = TestFix<Raw, FractionBits, arithmetic_mode::Ignore, RoundingMode>;
+	using raw_limits = std::numeric_limits<Raw>;
+	std::vector<Raw> inputs = {0, 1, -1, 2, -3, raw_limits::max(), raw_limits::min(), raw_limits::max() - 1, raw_limits::min() + 1};
+	std::uniform_int_distribution<i64> rand{i64l::min(), i64l::max()};
+	for (int i = 0; i < 512; ++i) {
+		inputs.push_back(static_cast<Raw>(rand(mtg) >> (64 - sizeof(Raw) * CHAR_BIT + i % (sizeof(Raw) * CHAR_BIT))));
+	}
+	const auto expect_op = [](const char* op, Raw x, Raw y, Sat sat, Wrap wrap, Sat checked_sat, status sat_status, Wrap checked_wrap, status wrap_status) {
+		const bool overflow = sat.raw() != wrap.raw();
+		EXPECT_EQ(checked_sat.raw(), sat.raw()) << +x << op << +y;
+		EXPECT_EQ(checked_wrap.raw(), wrap.raw()) << +x << op << +y;
+		EXPECT_EQ(wrap_status.flags, sat_status.flags) << +x << op << +y;
+		if (!overflow && (sat == Sat::max_sat() || sat == Sat::min_sat())) {
+			// the wrapped result can land exactly on a saturation bound
+			return;
+		}
+		EXPECT_EQ(sat_status.flags, overflow ? static_cast<fixmath::uint32_t>(status_flag::Overflow) : 0u) << +x << op << +y;
+	};
+	for (std::size_t i = 0; i < inputs.size(); ++i) {
+		for (std::size_t j : {i, (i * 7 + 3) % inputs.size(), (i + 1) % inputs.size(), std::size_t{3}, std::size_t{5}}) {
+			const Raw x = inputs[i];
+			const Raw y = inputs[j];
+			const Sat a = Sat::from_raw(x);
+			const Sat b = Sat::from_raw(y);
+			const Wrap wa = Wrap::from_raw(x);
+			const Wrap wb = Wrap::from_raw(y);
+			status s1;
+			status s2;
+			const Sat sum = checked_add(a, b, s1);
+			expect_op(" + ", x, y, a + b, wa + wb, sum, s1, checked_add(wa, wb, s2), s2);
+			s1.clear();
+			s2.clear();
+			const Sat difference = checked_sub(a, b, s1);
+			expect_op(" - ", x, y, a - b, wa - wb, difference, s1, checked_sub(wa, wb, s2), s2);
+			s1.clear();
+			s2.clear();
+			const Sat product = checked_mul(a, b, s1);
+			expect_op(" * ", x, y, a * b, wa * wb, product, s1, checked_mul(wa, wb, s2), s2);
+			if (y != 0) {
+				s1.clear();
+				s2.clear();
+				const Sat quotient = checked_div(a, b, s1);
+				expect_op(" / ", x, y, a / b, wa / wb, quotient, s1, checked_div(wa, wb, s2), s2);
+			}
+		}
+	}
+}
+
+TEST(FIXMATH, STATUS_FLAGS) {
+	check_checked_ops_match_operators<fixmath::int64_t, 32, rounding_mode::RoundToEven>();
+	check_checked_ops_match_operators<fixmath::int64_t, 32, rounding_mode::RoundToZero>();
+	check_checked_ops_match_operators<fixmath::int64_t, 16, rounding_mode::RoundToEven>();
+	check_checked_ops_match_operators<fixmath::int64_t, 48, rounding_mode::RoundToEven>();
+	check_checked_ops_match_operators<fixmath::int64_t, 62, rounding_mode::RoundToZero>();
+	check_checked_ops_match_operators<fixmath::int32_t, 8, rounding_mode::RoundToEven>();
+	check_checked_ops_match_operators<fixmath::int32_t, 3, rounding_mode::RoundToZero>();
+	check_checked_ops_match_operators<std::int16_t, 8, rounding_mode::RoundToEven>();
+
+	// division by zero returns what operator/ returns, without FIXMATH_ERROR
+	status st;
+	EXPECT_EQ(checked_div(Fix32(3), Fix32(0), st), Fix32::max_sat());
+	EXPECT_EQ(st.flags, static_cast<fixmath::uint32_t>(status_flag::DivideByZero));
+	EXPECT_EQ(checked_div(Fix32(-3), Fix32(0), st), Fix32::min_sat());
+	EXPECT_FALSE(st.test(status_flag::Invalid));
+	EXPECT_EQ(checked_div(Fix32(0), Fix32(0), st).raw(), Fix32::nan().raw());
+	EXPECT_TRUE(st.test(status_flag::Invalid));
+	EXPECT_FALSE(st.test(status_flag::Overflow));
+	status ignore_status;
+	EXPECT_EQ(checked_div(Fix32Ignore::max_fix(), Fix32Ignore(0), ignore_status).raw(), Fix32Ignore::nan().raw());
+	EXPECT_EQ(ignore_status.flags, static_cast<fixmath::uint32_t>(status_flag::DivideByZero));
+
+	// flags are sticky over a batch, and merge with |=
+	std::vector<Fix8Even32> values(1000, Fix8Even32(2));
+	values[617] = Fix8Even32::max_fix();
+	std::vector<Fix8Even32> out(values.size());
+	status worker[2];
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		out[i] = checked_mul(values[i], Fix8Even32(0.5), worker[i % 2]);
+	}
+	EXPECT_FALSE(worker[0].any());
+	EXPECT_FALSE(worker[1].any());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		out[i] = checked_add(values[i], Fix8Even32(1), worker[i % 2]);
+	}
+	EXPECT_EQ(out[616], 3);
+	EXPECT_EQ(out[617], Fix8Even32::max_sat());
+	EXPECT_EQ(out[618], 3);
+	EXPECT_FALSE(worker[0].any());
+	EXPECT_TRUE(worker[1].test(status_flag::Overflow));
+	status total;
+	total |= worker[0];
+	total |= worker[1];
+	EXPECT_EQ(total.flags, static_cast<fixmath::uint32_t>(status_flag::Overflow));
+	total.clear();
+	EXPECT_FALSE(total.any());
+}
+
+template <class Fix>
+void check_complex_fused_product() {
+	using C = complex<Fix>;
+	using raw_t = typename Fix::raw_t;
+	static_assert(sizeof(C) == 2 * sizeof(Fix));
+	std::uniform_int_distribution<raw_t> dist(std::numeric_limits<raw_t>::min(), std::numeric_limits<raw_t>::max());
+	for (int i = 0; i < 10000; ++i) {
+		const C a{Fix::from_raw(dist(mtg)), Fix::from_raw(dist(mtg))};
+		const Fix b = Fix::from_raw(dist(mtg));
+		// with one zero partial product per part there is nothing to fuse
+		EXPECT_EQ(a * C{b}, (C{a.re * b, a.im * b}));
+		EXPECT_EQ(a * C{b}, a * b);
+		EXPECT_EQ(norm(C{a.re}), a.re * a.re);
+		EXPECT_EQ(fma(a, C{b}, C{}), a * b);
+	}
+	// half a unit rounds to zero on its own, but two of them sum to a unit
+	const Fix tiny = Fix::epsilon();
+	const Fix half = Fix::from_raw(static_cast<raw_t>(raw_t{1} << (Fix::FRACTION_BITS - 1)));
+	EXPECT_EQ(tiny * half + tiny * half, 0);
+	EXPECT_EQ((C{tiny, tiny} * C{half, half}), (C{0, tiny}));
+	EXPECT_EQ(fma(C{tiny, tiny}, C{half, half}, C{0, tiny}), (C{0, tiny + tiny}));
+	// parts that overflow saturate, or wrap in Ignore mode, like operator*
+	const C low{Fix::min_fix(), Fix::min_fix()};
+	if constexpr (Fix::policy::ignore_mode) {
+		EXPECT_EQ((low * low).re, 0);
+	} else {
+		EXPECT_EQ(low * low, (C{0, Fix::max_sat()}));
+		EXPECT_EQ(fma(low, C{Fix::min_fix(), Fix::max_fix()}, C{Fix::max_fix(), 0}).re, Fix::max_sat());
+	}
+}
+
+TEST(FIXMATH, COMPLEX) {
+	using C = complex<Fix16Even32Sat>;
+	static_assert(C{3, 2} * C{1, -4} == C{11, -10});
+	static_assert(fma(C{3, 2}, C{1, -4}, C{-11, 10}) == C{});
+	static_assert(norm(C{3, -4}) == 25);
+	static_assert(conj(C{3, 2}) == C{3, -2});
+	static_assert(-C{3, 2} + C{1, 1} - C{0, 1} == C{-2, -2});
+	C z{1, 1};
+	z *= C{1, 1};
+	EXPECT_EQ(z, (C{0, 2}));
+	z += C{1};
+	z -= C{0, 1};
+	EXPECT_EQ(z, (C{1, 1}));
+	EXPECT_EQ(z * Fix16Even32Sat(2), (C{2, 2}));
+	EXPECT_EQ(Fix16Even32Sat(2) * z, (C{2, 2}));
+
+	check_complex_fused_product<Fix16Even32Sat>();
+	check_complex_fused_product<Fix16Zero32Sat>();
+	check_complex_fused_product<Fix16Even32Ignore>();
+	check_complex_fused_product<Fix31Even32Sat>();
+	check_complex_fused_product<Fix8Even16Sat>();
+	check_complex_fused_product<Fix32>();
+	check_complex_fused_product<Fix48Even64>();
+}
+
+template <class Fix>
+void check_complex_batch_matches_scalar() {
+	using C = complex<Fix>;
+	const auto random = random_fix<Fix>;
+	std::vector<C> a(1027);
+	std::vector<C> b(a.size());
+	std::vector<C> acc(a.size());
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a[i] = {random(), random()};
+		b[i] = {random(), random()};
+		acc[i] = {random(), random()};
+	}
+	// lanes whose 64-bit sums overflow take the scalar path for their block
+	const Fix edges[] = {Fix(0), Fix::epsilon(), -Fix::epsilon(), Fix::max_fix(), Fix::min_fix()};
+	for (std::size_t i = 0; i < std::size(edges); ++i) {
+		for (std::size_t j = 0; j < std::size(edges); ++j) {
+			a[40 + i * std::size(edges) + j] = {edges[i], edges[j]};
+			b[40 + i * std::size(edges) + j] = {edges[j], edges[i]};
+			acc[40 + i * std::size(edges) + j] = {edges[i], edges[i]};
+		}
+	}
+	std::vector<Fix> a_re, a_im, b_re, b_im, acc_re, acc_im;
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a_re.push_back(a[i].re);
+		a_im.push_back(a[i].im);
+		b_re.push_back(b[i].re);
+		b_im.push_back(b[i].im);
+		acc_re.push_back(acc[i].re);
+		acc_im.push_back(acc[i].im);
+	}
+	using policy = typename Fix::policy;
+	const parallel::options opts{3, 100};
+	// out may alias an operand
+	check_batch_matches_scalar(a, b, [&](const auto& x, const auto& y, auto& out) { parallel::complex_multiply<policy>(x, y, out, opts); }, std::multiplies<>{});
+	std::vector<C> out(a.size());
+	parallel::complex_multiply<policy>(a, b, out, opts);
+	std::vector<Fix> out_re(a.size());
+	std::vector<Fix> out_im(a.size());
+	parallel::complex_multiply<policy>(a_re, a_im, b_re, b_im, out_re, out_im, opts);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(out_re[i], out[i].re) << i;
+		ASSERT_EQ(out_im[i], out[i].im) << i;
+	}
+	std::vector<C> expected = acc;
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		expected[i] = fma(a[i], b[i], acc[i]);
+	}
+	parallel::complex_multiply_add<policy>(a, b, acc, opts);
+	parallel::complex_multiply_add<policy>(a_re, a_im, b_re, b_im, acc_re, acc_im, opts);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(acc[i], expected[i]) << i;
+		ASSERT_EQ(acc_re[i], expected[i].re) << i;
+		ASSERT_EQ(acc_im[i], expected[i].im) << i;
+	}
+}
+
+TEST(FIXMATH, PARALLEL_COMPLEX) {
+	check_complex_batch_matches_scalar<Fix16Even32Sat>();
+	check_complex_batch_matches_scalar<Fix16Zero32Sat>();
+	check_complex_batch_matches_scalar<Fix16Even32Ignore>();
+	check_complex_batch_matches_scalar<Fix31Even32Sat>();
+	check_complex_batch_matches_scalar<Fix31Zero32Ignore>();
+	check_complex_batch_matches_scalar<Fix3Even32>();
+	check_complex_batch_matches_scalar<Fix8Even16Sat>();
+	check_complex_batch_matches_scalar<Fix32>();
+}
+
+TEST(FIXMATH, VECTOR) {
+	using Q = Fix16Even32Sat;
+	using V3 = vec3<Q>;
+	using M3 = mat3<Q>;
+	static_assert(dot(V3{1, 2, 3}, V3{4, 5, -6}) == -4);
+	static_assert(cross(V3{1, 0, 0}, V3{0, 1, 0}) == V3{0, 0, 1});
+	static_assert(cross(V3{1, 2, 3}, V3{4, 5, 6}) == V3{-3, 6, -3});
+	static_assert(length(vec2<Q>{3, 4}) == 5);
+	static_assert(length_squared(vec4<Q>{1, 1, 1, 1}) == 4);
+	static_assert(M3::identity() * V3{1, 2, 3} == V3{1, 2, 3});
+	static_assert(sizeof(vec4<Q>) == 4 * sizeof(Q));
+
+	constexpr M3 m{V3{1, 2, 0}, V3{0, 1, 0}, V3{3, 0, 1}};
+	static_assert(m * V3{1, 1, 1} == V3{3, 1, 4});
+	static_assert(transpose(m)[0] == V3{1, 0, 3});
+	static_assert(m * M3::identity() == m);
+	static_assert(m * transpose(m) == M3{V3{5, 2, 3}, V3{2, 1, 0}, V3{3, 0, 10}});
+
+	V3 v{1, 2, 3};
+	v += V3{1, 1, 1};
+	v -= V3{0, 0, 1};
+	v *= Q(2);
+	EXPECT_EQ(v, (V3{4, 6, 6}));
+	EXPECT_EQ(-v + Q(0.5) * v, (V3{-2, -3, -3}));
+	v.z() = 1;
+	EXPECT_EQ(v.x() + v.y() + v.z(), 11);
+	EXPECT_EQ(vec4<Q>(1, 2, 3, 4).w(), 4);
+
+	// half a unit rounds to zero on its own, but two of them sum to a unit
+	const Q half(0.5);
+	EXPECT_EQ(Q::epsilon() * half + Q::epsilon() * half, 0);
+	EXPECT_EQ(dot(vec2<Q>{Q::epsilon(), Q::epsilon()}, vec2<Q>{half, half}), Q::epsilon());
+	// the squared length does not fit Q16.16, the length does
+	EXPECT_EQ(length_squared(vec2<Q>{300, 400}), Q::max_sat());
+	EXPECT_EQ(length(vec2<Q>{300, 400}), 500);
+	EXPECT_EQ(length(vec2<Q>{Q::min_fix(), Q::min_fix()}), Q::max_sat());
+	EXPECT_EQ(length(vec2<Q>{-3, 0}), 3);
+	EXPECT_EQ(length(vec4<Fix32>{Fix32::min_fix(), Fix32::min_fix(), Fix32::min_fix(), Fix32::min_fix()}), Fix32::max_sat());
+	EXPECT_EQ(length(vec3<Fix32>{2, 3, 6}), 7);
+	EXPECT_EQ(cross(vec3<Fix31Even32Sat>{Fix31Even32Sat::min_fix(), 0, 0}, vec3<Fix31Even32Sat>{0, Fix31Even32Sat::min_fix(), 0}).z(), Fix31Even32Sat::max_sat());
+
+	// products summed exactly, then rounded once
+	using Q31 = Fix31Even32Sat;
+	std::uniform_int_distribution<std::int32_t> dist(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max());
+	for (int i = 0; i < 10000; ++i) {
+		vec4<Q31> a;
+		vec4<Q31> b;
+		_fm_int192 sum = {};
+		for (std::size_t k = 0; k < 4; ++k) {
+			a[k] = Q31::from_raw(dist(mtg) >> (i % 4));
+			b[k] = Q31::from_raw(dist(mtg));
+			_fm_add(sum, _fm_product192<Q31::policy>(a[k].raw(), b[k].raw()));
+		}
+		ASSERT_EQ(dot(a, b), _fm_round_sum<Q31::policy>(sum));
+	}
+
+	// integer square roots of 128-bit values around exact squares
+	bool round_up = false;
+	EXPECT_EQ(_fm_isqrt128(0, 0, round_up), 0u);
+	EXPECT_EQ(_fm_isqrt128(~u64{0}, ~u64{0}, round_up), ~u64{0});
+	EXPECT_TRUE(round_up);
+	std::uniform_int_distribution<u64> roots;
+	for (int i = 0; i < 10000; ++i) {
+		const u64 root = roots(mtg) >> (i % 64);
+		u64 hi = 0;
+		const u64 lo = _fm_umul128(root, root, hi);
+		EXPECT_EQ(_fm_isqrt128(hi, lo, round_up), root);
+		EXPECT_FALSE(round_up);
+		// root^2 + root is below (root + 1/2)^2, root^2 + root + 1 above it
+		const u64 near_lo = lo + root;
+		const u64 near_hi = hi + (near_lo < lo);
+		EXPECT_EQ(_fm_isqrt128(near_hi, near_lo, round_up), root);
+		EXPECT_FALSE(round_up);
+		if (root > 1) {
+			EXPECT_EQ(_fm_isqrt128(near_hi + (near_lo == ~u64{0}), near_lo + 1, round_up), root);
+			EXPECT_TRUE(round_up);
+			EXPECT_EQ(_fm_isqrt128(hi - (lo == 0), lo - 1, round_up), root - 1);
+			EXPECT_TRUE(round_up);
+		}
+	}
+}
+
+template <class Fix, std::size_t N>
+void check_soa_batch_matches_scalar() {
+	using policy = typename Fix::policy;
+	const auto random = random_fix<Fix>;
+	mat<Fix, N> m;
+	for (std::size_t r = 0; r < N; ++r) {
+		for (std::size_t c = 0; c < N; ++c) {
+			m[r][c] = random();
+		}
+	}
+	vec_soa<Fix, N> a;
+	vec_soa<Fix, N> b(1027);
+	for (std::size_t i = 0; i < b.size(); ++i) {
+		vec<Fix, N> v;
+		for (std::size_t k = 0; k < N; ++k) {
+			v[k] = i % 97 == 0 ? Fix::min_fix() : random();
+			b.component(k)[i] = random();
+		}
+		a.push_back(v);
+	}
+	EXPECT_EQ(a.size(), b.size());
+	EXPECT_EQ(a.x().size(), a.size());
+	const parallel::options opts{3, 100};
+	vec_soa<Fix, N> out(a.size());
+	parallel::transform<policy, N>(m, a, out, opts);
+	std::vector<Fix> dots(a.size());
+	parallel::dot<policy, N>(a, b, dots, opts);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(out[i], m * a[i]) << i;
+		ASSERT_EQ(dots[i], dot(a[i], b[i])) << i;
+	}
+	// min_fix in every component and matrix element overflows the 64-bit lane sums
+	mat<Fix, N> low;
+	for (std::size_t r = 0; r < N; ++r) {
+		for (std::size_t c = 0; c < N; ++c) {
+			low[r][c] = Fix::min_fix();
+		}
+	}
+	vec<Fix, N> v;
+	for (std::size_t k = 0; k < N; ++k) {
+		v[k] = Fix::min_fix();
+	}
+	a.set(5, v);
+	EXPECT_EQ(a[5], v);
+	// out may be in
+	const vec_soa<Fix, N> before = a;
+	parallel::transform<policy, N>(low, a, a, opts);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(a[i], low * before[i]) << i;
+	}
+}
+
+TEST(FIXMATH, PARALLEL_VECTOR) {
+	check_soa_batch_matches_scalar<Fix16Even32Sat, 3>();
+	check_soa_batch_matches_scalar<Fix16Zero32Sat, 4>();
+	check_soa_batch_matches_scalar<Fix16Even32Ignore, 3>();
+	check_soa_batch_matches_scalar<Fix31Even32Sat, 2>();
+	check_soa_batch_matches_scalar<Fix31Even32Sat, 4>();
+	check_soa_batch_matches_scalar<Fix8Even16Sat, 3>();
+	check_soa_batch_matches_scalar<Fix32, 4>();
+}
+
+TEST(FIXMATH, RAW_SPAN) {
+	using Q = Fix16Even32Sat;
+	std::int32_t buffer[4] = {1 << 16, 3 << 15, -(1 << 16), 0};
+	const std::span<Q, 4> values = as_fixed_span<Q::policy>(std::span(buffer));
+	EXPECT_EQ(values[0], 1);
+	EXPECT_EQ(values[1], Q(1.5));
+	EXPECT_EQ(values[2], -1);
+	// both views address the same storage
+	values[3] = Q(2);
+	EXPECT_EQ(buffer[3], 2 << 16);
+	buffer[0] = 5 << 16;
+	EXPECT_EQ(values[0], 5);
+	EXPECT_EQ(static_cast<const void*>(values.data()), static_cast<const void*>(buffer));
+
+	const std::span<std::int32_t, 4> raw = as_raw_span(values);
+	EXPECT_EQ(raw.data(), buffer);
+	const std::vector<std::int32_t> wire = {7, -7};
+	const std::span<const Q> read_only = as_fixed_span<Q::policy>(std::span(wire));
+	EXPECT_EQ(read_only.size(), 2u);
+	EXPECT_EQ(read_only[1].raw(), -7);
+	EXPECT_EQ(as_raw_span(read_only).data(), wire.data());
+	std::uint32_t bits[1] = {0xffffffffu};
+	EXPECT_EQ(as_fixed_span<Q::policy>(std::span(bits))[0].raw(), -1);
+
+	// the view feeds batch operations without a copy
+	std::vector<fixmath::int64_t> a(100, fixmath::int64_t{3} << 32);
+	std::vector<fixmath::int64_t> b(100, fixmath::int64_t{1} << 31);
+	parallel::multiply<Fix32::policy>(as_fixed_span<Fix32::policy>(std::span(a)), as_fixed_span<Fix32::policy>(std::span(b)), as_fixed_span<Fix32::policy>(std::span(a)));
+	EXPECT_EQ(a[99], fixmath::int64_t{3} << 31);
+
+	static_assert(std::is_same_v<decltype(as_fixed_span<Q::policy>(std::span<const std::int32_t>())), std::span<const Q>>);
+	static_assert(!_fm_raw_element<std::int16_t, Q::policy>);
+	static_assert(!_fm_raw_element<std::int32_t, Fix32::policy>);
+	static_assert(_fm_raw_element<const fixmath::uint64_t, Fix32::policy>);
+}
+
+TEST(FIXMATH, HYPOT) {
+	static_assert(hypot(Fix16Even32Sat(3), Fix16Even32Sat(4)) == 5);
+	EXPECT_EQ(hypot(Fix32(3), Fix32(-4)), 5);
+	EXPECT_EQ(hypot(Fix32(2), Fix32(3), Fix32(-6)), 7);
+	EXPECT_EQ(hypot(Fix32(0), Fix32(0)), 0);
+
+	// the squares leave the range of Q32.32 long before the result does
+	const Fix32 big(1500000000);
+	EXPECT_EQ(sqrt(big * big + big * big), sqrt(Fix32::max_sat()));
+	EXPECT_EQ(hypot(big, big).raw(), fixmath::int64_t{9111001499928149077});
+	EXPECT_EQ(hypot(Fix32(-1200000000), Fix32(1600000000)), 2000000000);
+	EXPECT_EQ(hypot(Fix32::max_fix(), Fix32::max_fix()), Fix32::max_sat());
+	EXPECT_EQ(hypot(Fix32::min_fix(), Fix32::min_fix(), Fix32::min_fix()), Fix32::max_sat());
+
+	// and tiny ones are not rounded to zero before the sum
+	const Fix32 eps = Fix32::epsilon();
+	EXPECT_EQ(sqrt(eps * 3 * (eps * 3) + eps * 4 * (eps * 4)), 0);
+	EXPECT_EQ(hypot(eps * 3, eps * 4), eps * 5);
+	EXPECT_EQ(hypot(eps * 2, eps * 2), eps * 3);
+	EXPECT_EQ(hypot(Fix32Zero::epsilon() * 2, Fix32Zero::epsilon() * 2), Fix32Zero::epsilon() * 2);
+
+	// correctly rounded: (2 * root - 1)^2 <= 4 * sum <= (2 * root + 1)^2, compared as 128-bit hi/lo pairs
+	const auto square = [](u64 x) {
+		u64 hi = 0;
+		const u64 lo = fixmath::_fm_umul128(x, x, hi);
+		return std::pair{hi, lo};
+	};
+	fixmath::uint64_t seed = 12345;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const fixmath::int64_t a = static_cast<fixmath::int64_t>(seed) >> (4 + i % 50);
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const fixmath::int64_t b = static_cast<fixmath::int64_t>(seed) >> (4 + i % 40);
+		// |a|, |b| < 2^59, so 4 * (a^2 + b^2) < 2^121
+		const auto [a_hi, a_lo] = square(static_cast<u64>(a < 0 ? -a : a));
+		const auto [b_hi, b_lo] = square(static_cast<u64>(b < 0 ? -b : b));
+		const u64 lo = a_lo + b_lo;
+		const u64 hi = a_hi + b_hi + (lo < a_lo);
+		const std::pair sum4{(hi << 2) | (lo >> 62), lo << 2};
+		const u64 root = static_cast<u64>(hypot(Fix32::from_raw(Fix32::raw_t{a}), Fix32::from_raw(Fix32::raw_t{b})).raw());
+		if (root != 0) {
+			EXPECT_LE(square(2 * root - 1), sum4);
+		}
+		EXPECT_GE(square(2 * root + 1), sum4);
+	}
+
+	EXPECT_EQ(hypot(Fix16Even32Sat(30000), Fix16Even32Sat(-20000)), Fix16Even32Sat::max_sat());
+	EXPECT_EQ(hypot(Fix15Even16Sat::from_raw(Fix15Even16Sat::raw_t{19661}), Fix15Even16Sat::from_raw(Fix15Even16Sat::raw_t{9830})).raw(), 21981);
+
+	EXPECT_TRUE(hypot(Fix32Strict::inf(), Fix32Strict::nan()).is_inf());
+	EXPECT_TRUE(hypot(Fix32Strict(1), -Fix32Strict::inf()).is_inf());
+	EXPECT_TRUE(hypot(Fix32Strict(1), Fix32Strict(2), Fix32Strict::nan()).is_nan());
+	EXPECT_TRUE(hypot(Fix32Strict::max_fix(), Fix32Strict::max_fix()).is_inf());
+	EXPECT_EQ(hypot(Fix31Even32Strict(0.5), Fix31Even32Strict(-0.5)).raw(), 1518500250);
+}
+
+TEST(FIXMATH, IPOW) {
+	EXPECT_EQ(ipow(Fix32(3), 4), 81);
+	EXPECT_EQ(ipow(Fix32(-2), 3), -8);
+	EXPECT_EQ(ipow(Fix32(1.5), 2), Fix32(2.25));
+	EXPECT_EQ(ipow(Fix32(2), -3), Fix32(0.125));
+	EXPECT_EQ(ipow(Fix32(-0.5), -3), -8);
+	EXPECT_EQ(ipow(Fix32(7), 0), 1);
+	EXPECT_EQ(ipow(Fix32(7), 1), 7);
+	EXPECT_EQ(ipow(Fix32(0), 3), 0);
+	EXPECT_EQ(ipow(Fix32(-1), std::numeric_limits<fixmath::int32_t>::min()), 1);
+
+	// rounded once, where the operator* loop rounds 29 times
+	const Fix32 rate = Fix32::from_raw(Fix32::raw_t{4509715661});
+	EXPECT_EQ(ipow(rate, 30).raw(), fixmath::int64_t{18562601181});
+	EXPECT_EQ(ipow(Fix32(1) + Fix32::epsilon(), 1 << 30).raw(), fixmath::int64_t{5514847172});
+
+	// ties and the rounding mode
+	EXPECT_EQ(ipow(Fix8Even32::from_raw(Fix8Even32::raw_t{44}), 2).raw(), 8);
+	EXPECT_EQ(ipow(Fix8Zero32::from_raw(Fix8Zero32::raw_t{44}), 2).raw(), 7);
+	EXPECT_EQ(ipow(Fix32(2), -32), Fix32::epsilon());
+	EXPECT_EQ(ipow(Fix32(2), -33), 0);
+	EXPECT_EQ(ipow(Fix32(3), -10).raw(), 72736);
+
+	// out of range
+	EXPECT_EQ(ipow(Fix32(2), 31), Fix32::max_sat());
+	EXPECT_EQ(ipow(Fix32(-2), 31), Fix32::min_fix());
+	EXPECT_EQ(ipow(Fix32(-2), 33), Fix32::min_sat());
+	EXPECT_EQ(ipow(Fix32::epsilon(), -2), Fix32::max_sat());
+	EXPECT_EQ(ipow(Fix31Even32Sat(-0.5), -1), Fix31Even32Sat::min_fix());
+	EXPECT_EQ(ipow(Fix31Even32Sat(0.5), -1), Fix31Even32Sat::max_sat());
+	EXPECT_FIX_DOMAIN_ERROR(ipow(Fix32(0), -1));
+
+	EXPECT_TRUE(ipow(Fix32Strict::inf(), 2).is_inf());
+	EXPECT_TRUE(ipow(-Fix32Strict::inf(), 3) < 0);
+	EXPECT_EQ(ipow(Fix32Strict::inf(), -1), 0);
+	EXPECT_TRUE(ipow(Fix32Strict::nan(), 2).is_nan());
+	EXPECT_EQ(ipow(Fix32Strict::nan(), 0), 1);
+	EXPECT_TRUE(ipow(Fix32Strict(2), 40).is_inf());
+
+	// correctly rounded against long double in Q16.16
+	fixmath::uint64_t seed = 777;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const int32_t raw = static_cast<int32_t>(seed >> 32) >> (i % 16);
+		const int n = static_cast<int>(seed % 13) - 6;
+		if (raw == 0) {
+			continue;
+		}
+		const long double exact = std::pow(static_cast<long double>(raw) / 65536, n) * 65536;
+		if (std::fabs(exact) >= 0x1p31L) {
+			continue;
+		}
+		const Fix16Even32Sat result = ipow(Fix16Even32Sat::from_raw(Fix16Even32Sat::raw_t{raw}), n);
+		EXPECT_LE(std::fabs(result.raw() - exact), 0.5L + 1e-6L) << raw << " ^ " << n;
+	}
+}
+
+TEST(FIXMATH, CBRT) {
+	EXPECT_EQ(cbrt(Fix32(27)), 3);
+	EXPECT_EQ(cbrt(Fix32(-8)), -2);
+	EXPECT_EQ(cbrt(Fix32(0.125)), Fix32(0.5));
+	EXPECT_EQ(cbrt(Fix32(0)), 0);
+	EXPECT_EQ(cbrt(Fix32::max_fix()).raw(), fixmath::int64_t{5541191377757});
+	EXPECT_EQ(cbrt(Fix32::epsilon()).raw(), 2642246);
+	EXPECT_EQ(cbrt(Fix16Even32Sat(-1000)), -10);
+	EXPECT_EQ(cbrt(Fix31Even32Sat::max_fix()), Fix31Even32Sat::max_sat());
+	EXPECT_EQ(cbrt(Fix31Even32Sat::min_fix()), Fix31Even32Sat::min_fix());
+	EXPECT_EQ(cbrt(Fix16Even32Sat(2)).raw(), 82570);
+	EXPECT_EQ(cbrt(Fix16Zero32Sat(2)).raw(), 82570);
+	EXPECT_EQ(cbrt(Fix16Zero32Sat(5)).raw(), 112064);
+	EXPECT_EQ(cbrt(Fix16Even32Sat(5)).raw(), 112065);
+
+	EXPECT_TRUE(cbrt(Fix32Strict::nan()).is_nan());
+	EXPECT_TRUE(cbrt(-Fix32Strict::inf()).is_inf());
+
+	// correctly rounded: (2 |root| - 1)^3 <= 8 |raw| 2^2F <= (2 |root| + 1)^3, compared as
+	// 128-bit hi/lo pairs; |raw| < 2^50 and |root| < 2^38 keep every term below 2^117
+	const auto cube = [](u64 x) {
+		u64 square_hi = 0;
+		const u64 square_lo = fixmath::_fm_umul128(x, x, square_hi);
+		u64 hi = 0;
+		const u64 lo = fixmath::_fm_umul128(square_lo, x, hi);
+		return std::pair{hi + square_hi * x, lo};
+	};
+	fixmath::uint64_t seed = 4242;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const fixmath::int64_t raw = static_cast<fixmath::int64_t>(seed) >> (14 + i % 48);
+		const fixmath::int64_t root = cbrt(Fix32::from_raw(Fix32::raw_t{raw})).raw();
+		EXPECT_EQ(root < 0, raw < 0) << raw;
+		const std::pair v8{static_cast<u64>(raw < 0 ? -raw : raw) << 3, u64{0}};
+		const u64 magnitude = static_cast<u64>(root < 0 ? -root : root);
+		if (magnitude != 0) {
+			EXPECT_LE(cube(2 * magnitude - 1), v8) << raw;
+		}
+		EXPECT_GE(cube(2 * magnitude + 1), v8) << raw;
+	}
+}
+
+TEST(FIXMATH, EXP2_LOG2_POW) {
+	EXPECT_EQ(exp2(Fix32(0)), 1);
+	EXPECT_EQ(exp2(Fix32(10)), 1024);
+	EXPECT_EQ(exp2(Fix32(-3)), Fix32(0.125));
+	EXPECT_EQ(exp2(Fix32(0.5)).raw(), fixmath::int64_t{6074001000});
+	EXPECT_EQ(exp2(Fix32(-32)), Fix32::epsilon());
+	EXPECT_EQ(exp2(Fix32(-33)), 0);
+	EXPECT_EQ(exp2(Fix32(31)), Fix32::max_sat());
+	EXPECT_EQ(exp2(Fix32::min_fix()), 0);
+	EXPECT_EQ(exp2(Fix31Even32Sat(-0.5)).raw(), 1518500250);
+
+	EXPECT_EQ(log2(Fix32(1)), 0);
+	EXPECT_EQ(log2(Fix32(1024)), 10);
+	EXPECT_EQ(log2(Fix32(0.25)), -2);
+	EXPECT_EQ(log2(Fix32::epsilon()), -32);
+	EXPECT_EQ(log2(Fix32::max_fix()), 31);
+	EXPECT_EQ(log2(Fix32(3)).raw(), fixmath::int64_t{6807362106});
+	EXPECT_EQ(log2(Fix32(0)), Fix32::min_sat());
+	EXPECT_EQ(log2(Fix15Even16Sat::epsilon()), Fix15Even16Sat::min_sat());
+	EXPECT_FIX_DOMAIN_ERROR(log2(Fix32(-1)));
+
+	// RoundToZero truncates the magnitude on both sides of one
+	EXPECT_EQ(log2(Fix16Zero32Sat(0.75)).raw(), -27199);
+	EXPECT_EQ(log2(Fix16Even32Sat(0.75)).raw(), -27200);
+	EXPECT_EQ(log2(Fix16Zero32Sat(1.5)).raw(), 38336);
+	EXPECT_EQ(log2(Fix16Zero32Sat(0.5)).raw(), -65536);
+	EXPECT_EQ(log2(Fix16Zero32Sat::epsilon()).raw(), -16 * 65536);
+	EXPECT_EQ(log2(Fix32Zero::from_raw(Fix32Zero::raw_t{3})).raw(), fixmath::int64_t{-130631591366});
+
+	EXPECT_EQ(exp2(Fix32Strict::inf()), Fix32Strict::inf());
+	EXPECT_EQ(exp2(-Fix32Strict::inf()), 0);
+	EXPECT_TRUE(exp2(Fix32Strict::nan()).is_nan());
+	EXPECT_TRUE(log2(Fix32Strict(0)).is_inf());
+	EXPECT_TRUE(log2(Fix32Strict(0)) < 0);
+	EXPECT_TRUE(log2(Fix32Strict::inf()).is_inf());
+
+	// within half an ulp of long double
+	fixmath::uint64_t seed = 99;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const int32_t raw = static_cast<int32_t>(seed >> 32) >> (4 + i % 24);
+		const long double power = std::exp2(static_cast<long double>(raw) / 65536) * 65536;
+		EXPECT_LE(power < 0x1p31L ? std::fabs(exp2(Fix16Even32Sat::from_raw(Fix16Even32Sat::raw_t{raw})).raw() - power) : 0, 0.5L + 1e-6L) << raw;
+
+		const fixmath::int64_t positive = static_cast<fixmath::int64_t>(seed >> (1 + i % 62)) + 1;
+		const long double logarithm = std::log2(static_cast<long double>(positive) / 0x1p32L) * 0x1p32L;
+		EXPECT_LE(std::fabs(log2(Fix32::from_raw(Fix32::raw_t{positive})).raw() - logarithm), 0.5L + 1e-6L) << positive;
+	}
+
+	EXPECT_EQ(pow(Fix32(2), Fix32(10)), 1024);
+	EXPECT_EQ(pow(Fix32(-2), Fix32(3)), -8);
+	EXPECT_EQ(pow(Fix32(2), Fix32(-2)), Fix32(0.25));
+	EXPECT_EQ(pow(Fix32(4), Fix32(0.5)), 2);
+	EXPECT_EQ(pow(Fix32(8), Fix32(-1.5)).raw(), exp2(Fix32(-4.5)).raw());
+	EXPECT_LE(std::abs(pow(Fix32(2), Fix32(0.5)).raw() - fixmath::int64_t{6074001000}), 1);
+	EXPECT_EQ(pow(Fix32(0), Fix32(0.5)), 0);
+	EXPECT_EQ(pow(Fix32(10), Fix32(9.5)), Fix32::max_sat());
+	EXPECT_EQ(pow(Fix16Even64(-1), Fix16Even64(4294967297.0)), -1);
+	EXPECT_FIX_DOMAIN_ERROR(pow(Fix32(-2), Fix32(0.5)));
+	EXPECT_FIX_DOMAIN_ERROR(pow(Fix32(0), Fix32(-0.5)));
+
+	// formats whose b log2(a) has up to 112 fraction bits
+	using Fix56Even64Sat = TestFix<fixmath::int64_t, 56, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>;
+	EXPECT_LE(std::abs(pow(Fix48Even64(2), Fix48Even64(1.5)).raw() - fixmath::int64_t{796131459065722}), 1);
+	EXPECT_LE(std::abs(pow(Fix48Even64(1.5), Fix48Even64(0.5)).raw() - fixmath::int64_t{344735034151443}), 1);
+	EXPECT_LE(std::abs(pow(Fix48Even64(3), Fix48Even64(2.5)).raw() - fixmath::int64_t{4387760646499104}), 1);
+	EXPECT_EQ(pow(Fix48Even64(2), Fix48Even64(15.5)), Fix48Even64::max_sat());
+	EXPECT_EQ(pow(Fix48Even64(2), Fix48Even64(-60.5)), 0);
+	EXPECT_LE(std::abs(pow(Fix56Even64Sat(2), Fix56Even64Sat(1.5)).raw() - fixmath::int64_t{203809653520824722}), 8);
+	EXPECT_LE(std::abs(pow(Fix56Even64Sat(1.5), Fix56Even64Sat(0.5)).raw() - fixmath::int64_t{88252168742769384}), 2);
+	EXPECT_EQ(pow(Fix56Even64Sat(2), Fix56Even64Sat(7.5)), Fix56Even64Sat::max_sat());
+
+	const long double growth = std::pow(static_cast<long double>(Fix32(1.05).raw()) / 0x1p32L, 10.5L) * 0x1p32L;
+	EXPECT_LE(std::fabs(pow(Fix32(1.05), Fix32(10.5)).raw() - growth), 1);
+
+	EXPECT_EQ(pow(Fix32Strict::nan(), Fix32Strict(0)), 1);
+	EXPECT_EQ(pow(Fix32Strict(1), Fix32Strict::nan()), 1);
+	EXPECT_TRUE(pow(Fix32Strict(2), Fix32Strict::inf()).is_inf());
+	EXPECT_EQ(pow(Fix32Strict(0.5), Fix32Strict::inf()), 0);
+	EXPECT_EQ(pow(Fix32Strict(2), -Fix32Strict::inf()), 0);
+	EXPECT_TRUE(pow(Fix32Strict::inf(), Fix32Strict(0.5)).is_inf());
+	EXPECT_EQ(pow(Fix32Strict::inf(), Fix32Strict(-0.5)), 0);
+}
+
+TEST(FIXMATH, WIDE_PRODUCT) {
+	static_assert(mul_wide(Fix16Even32Sat(3), Fix16Even32Sat(-4)).narrow() == -12);
+	EXPECT_EQ(mul_wide(Fix32(1.5), Fix32(2)).narrow(), 3);
+	EXPECT_EQ(mul_wide(Fix32(3), Fix32(4)), Fix32(12));
+	EXPECT_LT(mul_wide(Fix32(3), Fix32(4)), Fix32(12) + Fix32::epsilon());
+	EXPECT_EQ(-mul_wide(Fix32(3), Fix32(4)), mul_wide(Fix32(-3), Fix32(4)));
+
+	// rounding happens only in narrow, with the policy's mode unless another is given
+	const Fix32 eps = Fix32::epsilon();
+	EXPECT_EQ(mul_wide(eps, Fix32(1.5)).narrow(), eps * 2);
+	EXPECT_EQ(mul_wide(eps, Fix32(1.5)).narrow<rounding_mode::RoundToZero>(), eps);
+	EXPECT_EQ(mul_wide(eps, Fix32(0.5)).narrow(), 0);
+	EXPECT_EQ(mul_wide(Fix32Zero::epsilon(), Fix32Zero(-1.5)).narrow(), -Fix32Zero::epsilon());
+	EXPECT_EQ(mul_wide(Fix32Zero::epsilon(), Fix32Zero(-1.5)).narrow<rounding_mode::RoundToEven>(), -Fix32Zero::epsilon() * 2);
+
+	// products that round to the same raw still compare exactly
+	EXPECT_EQ(eps * Fix32(0.25), eps * Fix32(0.375));
+	EXPECT_LT(mul_wide(eps, Fix32(0.25)), mul_wide(eps, Fix32(0.375)));
+	EXPECT_GT(mul_wide(eps, Fix32(0.25)), Fix32(0));
+
+	// and sums leave the range of the format without saturating
+	const Fix32 big(100000);
+	EXPECT_GT(mul_wide(big, big), Fix32::max_fix());
+	EXPECT_EQ((mul_wide(big, big) - mul_wide(big, Fix32(99999))).narrow(), 100000);
+	fixed_wide<Fix32::policy> sum;
+	for (int i = 0; i < 4; ++i) {
+		sum += mul_wide(Fix32::min_fix(), Fix32::min_fix());
+	}
+	EXPECT_EQ(sum.narrow(), Fix32::max_sat());
+	for (int i = 0; i < 4; ++i) {
+		sum -= mul_wide(Fix32::min_fix(), Fix32::min_fix());
+	}
+	EXPECT_EQ(sum, Fix32(0));
+	fixed_wide<Fix16Even32Sat::policy> narrow_sum = mul_wide(Fix16Even32Sat::min_fix(), Fix16Even32Sat::min_fix());
+	narrow_sum += narrow_sum;
+	EXPECT_EQ(narrow_sum.narrow(), Fix16Even32Sat::max_sat());
+	EXPECT_EQ((-narrow_sum).narrow(), Fix16Even32Sat::min_sat());
+
+	// a single product narrows to exactly what operator* returns
+	fixmath::uint64_t seed = 2024;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const fixmath::int64_t a = static_cast<fixmath::int64_t>(seed) >> (i % 48);
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const fixmath::int64_t b = static_cast<fixmath::int64_t>(seed) >> (i % 40);
+		EXPECT_EQ(mul_wide(Fix32::from_raw(Fix32::raw_t{a}), Fix32::from_raw(Fix32::raw_t{b})).narrow(), Fix32::from_raw(Fix32::raw_t{a}) * Fix32::from_raw(Fix32::raw_t{b}));
+		EXPECT_EQ(mul_wide(Fix32Zero::from_raw(Fix32Zero::raw_t{a}), Fix32Zero::from_raw(Fix32Zero::raw_t{b})).narrow(), Fix32Zero::from_raw(Fix32Zero::raw_t{a}) * Fix32Zero::from_raw(Fix32Zero::raw_t{b}));
+		EXPECT_EQ(mul_wide(Fix32Ignore::from_raw(Fix32Ignore::raw_t{a}), Fix32Ignore::from_raw(Fix32Ignore::raw_t{b})).narrow(), Fix32Ignore::from_raw(Fix32Ignore::raw_t{a}) * Fix32Ignore::from_raw(Fix32Ignore::raw_t{b}));
+		const Fix16Even32Sat c = Fix16Even32Sat::from_raw(static_cast<fixmath::int32_t>(a >> 16));
+		const Fix16Even32Sat d = Fix16Even32Sat::from_raw(static_cast<fixmath::int32_t>(b >> 24));
+		EXPECT_EQ(mul_wide(c, d).narrow(), c * d);
+		const Fix15Even16Sat e = Fix15Even16Sat::from_raw(static_cast<std::int16_t>(a));
+		const Fix15Even16Sat f = Fix15Even16Sat::from_raw(static_cast<std::int16_t>(b));
+		EXPECT_EQ(mul_wide(e, f).narrow(), e * f);
+		EXPECT_EQ(mul_wide(e, f) < mul_wide(f, f), static_cast<fixmath::int32_t>(e.raw()) * f.raw() < static_cast<fixmath::int32_t>(f.raw()) * f.raw());
+	}
+}
+
+TEST(FIXMATH, COUNTERS_DISABLED) {
+	// counter_tests.cpp covers FIXMATH_USE_COUNTERS=1; here the API compiles and reads zero
+	static_assert(!FIXMATH_USE_COUNTERS);
+	EXPECT_EQ(Fix32(3) * Fix32(2), 6);
+	counters::reset();
+	counters::reset_all_threads();
+	const counter_snapshot snapshot = counters::snapshot_all_threads();
+	for (std::size_t i = 0; i < static_cast<std::size_t>(counter::Count); ++i) {
+		EXPECT_EQ(snapshot.values[i], 0u);
+	}
+	EXPECT_STREQ(counter_name(counter::DivShlN), "DivShlN");
+}
+
 TEST(FIXMATH, CONCEPT) {
 	static_assert(func(1, Fix32(1)) == 2);
 	static_assert(func(Fix32(1), 1) == 1);
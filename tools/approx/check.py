@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Verify existing raw coefficients under a spec without refitting them."""
+
+from __future__ import annotations
+
+import argparse
+import dataclasses
+import sys
+from pathlib import Path
+
+import mpmath as mp
+
+from fixmath_approx.remez import locate_extrema
+from fixmath_approx.specification import load_spec
+from fixmath_approx.verify import verify
+
+
+def main() -> int:
+	parser = argparse.ArgumentParser()
+	parser.add_argument("--spec", type=Path, required=True)
+	parser.add_argument("--coefficients", required=True, help="comma-separated raw coefficients in descending Horner order")
+	parser.add_argument("--scheme", choices=("horner", "estrin"), help="override the spec's evaluation_scheme")
+	args = parser.parse_args()
+	spec = load_spec(args.spec)
+	if args.scheme is not None:
+		spec = dataclasses.replace(spec, scheme=args.scheme)
+	raw_coefficients = [int(value) for value in reversed(args.coefficients.split(","))]
+	if len(raw_coefficients) != len(spec.powers):
+		print(f"error: the spec has {len(spec.powers)} coefficients", file=sys.stderr)
+		return 2
+	mp.mp.dps = spec.precision_digits
+	# Probe the error extrema of the quantized polynomial itself, as generate.py does after quantization.
+	extrema = locate_extrema(spec.target, [mp.mpf(value) / spec.scale for value in raw_coefficients], spec.interval, spec.remez_grid_size)
+	verification = verify(spec, raw_coefficients, extrema)
+	print(f"scheme: {spec.scheme}")
+	print(f"maximum implemented error: {verification.maximum_implemented_error_ulp} ulp at raw input {verification.worst_raw_input} ({verification.checked_inputs} inputs checked)")
+	print(f"largest product inside q: {verification.maximum_product_bits} bits; largest stage raw: {verification.maximum_stage_raw}")
+	print(f"verification level: {verification.level}")
+	if verification.overflow or verification.maximum_product_bits > spec.width:
+		print("error: evaluator overflow observed", file=sys.stderr)
+		return 3
+	if verification.maximum_implemented_error_ulp > spec.target_ulp:
+		print(f"error: target is {spec.target_ulp} ulp", file=sys.stderr)
+		return 4
+	return 0
+
+
+if __name__ == "__main__":
+	raise SystemExit(main())
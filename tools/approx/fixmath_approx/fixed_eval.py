@@ -1,4 +1,4 @@
-"""Exact integer model of the Fixmath factored Horner evaluator."""
+"""Exact integer models of the Fixmath factored Horner and Estrin evaluators."""
 
 from dataclasses import dataclass
 
@@ -18,20 +18,28 @@ def div_pow2(value: int, fraction_bits: int, rounding: str) -> int:
 class Evaluation:
 	raw: int
 	maximum_numerator_bits: int
+	# Signed width of the largest raw product inside q. _fm_horner_fast64 and
+	# _fm_estrin_fast64 form those products in raw_t, so it must not exceed the width.
+	maximum_product_bits: int
 	maximum_stage_raw: int
 	overflow: bool
 
 
-def evaluate_factored(raw_x: int, raw_coefficients: list[int], width: int, fraction_bits: int, rounding: str) -> Evaluation:
+def evaluate_factored(raw_x: int, raw_coefficients: list[int], width: int, fraction_bits: int, rounding: str, odd: bool = True, scheme: str = "horner") -> Evaluation:
+	"""Evaluate x * q(x^2), or q(x^2) alone when odd is false, with q in the given scheme."""
 	scale = 1 << fraction_bits
 	limit_min, limit_max = -(1 << (width - 1)), (1 << (width - 1)) - 1
 	wide_limit_min, wide_limit_max = -(1 << (2 * width - 1)), (1 << (2 * width - 1)) - 1
 	maximum_bits = 0
+	maximum_product_bits = 0
 	maximum_stage = 0
 	overflow = False
 
-	def stage(numerator):
-		nonlocal maximum_bits, maximum_stage, overflow
+	def stage(product, addend=0, in_q=True):
+		nonlocal maximum_bits, maximum_product_bits, maximum_stage, overflow
+		if in_q:
+			maximum_product_bits = max(maximum_product_bits, abs(product).bit_length() + 1)
+		numerator = product + addend * scale
 		maximum_bits = max(maximum_bits, abs(numerator).bit_length() + 1)
 		overflow = overflow or not (wide_limit_min <= numerator <= wide_limit_max)
 		value = div_pow2(numerator, fraction_bits, rounding)
@@ -39,11 +47,28 @@ def evaluate_factored(raw_x: int, raw_coefficients: list[int], width: int, fract
 		overflow = overflow or not (limit_min <= value <= limit_max)
 		return value
 
-	z = stage(raw_x * raw_x)
-	horner = raw_coefficients[-1]
-	maximum_stage = max(maximum_stage, abs(horner))
-	overflow = overflow or not (limit_min <= horner <= limit_max)
-	for coefficient in reversed(raw_coefficients[:-1]):
-		horner = stage(horner * z + coefficient * scale)
-	result = stage(raw_x * horner)
-	return Evaluation(result, maximum_bits, maximum_stage, overflow)
+	def operand(value):
+		nonlocal maximum_stage, overflow
+		maximum_stage = max(maximum_stage, abs(value))
+		overflow = overflow or not (limit_min <= value <= limit_max)
+		return value
+
+	z = stage(raw_x * raw_x, in_q=False)
+	if scheme == "horner":
+		polynomial = operand(raw_coefficients[-1])
+		for coefficient in reversed(raw_coefficients[:-1]):
+			polynomial = stage(polynomial * z, coefficient)
+	elif scheme == "estrin":
+		# Pair terms as t_2i + t_(2i+1) * p, square p, and repeat; p starts at z.
+		terms = [operand(coefficient) for coefficient in raw_coefficients]
+		power = z
+		while len(terms) > 1:
+			pairs = [stage(terms[i + 1] * power, terms[i]) for i in range(0, len(terms) - 1, 2)]
+			terms = pairs + terms[len(terms) - 1 :] if len(terms) % 2 else pairs
+			if len(terms) > 1:
+				power = stage(power * power)
+		polynomial = terms[0]
+	else:
+		raise ValueError(f"unknown evaluation scheme {scheme!r}")
+	result = stage(raw_x * polynomial, in_q=False) if odd else polynomial
+	return Evaluation(result, maximum_bits, maximum_product_bits, maximum_stage, overflow)
@@ -27,7 +27,7 @@ def _objective(spec, coefficients, raw_inputs, oracle):
 	worst_error = -1
 	worst_input = 0
 	for raw_x, expected in zip(raw_inputs, oracle):
-		actual = evaluate_factored(raw_x, coefficients, spec.width, spec.fraction_bits, spec.rounding).raw
+		actual = evaluate_factored(raw_x, coefficients, spec.width, spec.fraction_bits, spec.rounding, spec.odd, spec.scheme).raw
 		error = abs(actual - expected)
 		if error > worst_error:
 			worst_error, worst_input = error, raw_x
@@ -42,13 +42,13 @@ def _real_samples(spec, sample_count=2049):
 	return result
 
 
-def _real_objective(coefficients, scale, samples):
+def _real_objective(coefficients, scale, samples, odd):
 	maximum = mp.mpf(0)
 	for x, z, target in samples:
 		horner = mp.mpf(coefficients[-1]) / scale
 		for coefficient in reversed(coefficients[:-1]):
 			horner = horner * z + mp.mpf(coefficient) / scale
-		maximum = max(maximum, abs(x * horner - target))
+		maximum = max(maximum, abs((x * horner if odd else horner) - target))
 	return maximum
 
 
@@ -64,11 +64,12 @@ def search(spec, coefficients, sample_count=16385):
 	real_samples = _real_samples(spec)
 	best = initial[:]
 	best_score, best_input = _objective(spec, best, raw_inputs, oracle)
-	best_real_score = _real_objective(best, scale, real_samples)
+	best_real_score = _real_objective(best, scale, real_samples, spec.odd)
 	evaluations = 1
 	for _ in range(spec.quantize_passes):
 		changed = False
-		for index in range(len(best)):
+		# A fixed constant is part of the specification, so the search never moves it.
+		for index in range(1 if spec.fixed_constant is not None else 0, len(best)):
 			center = best[index]
 			local_best = (best_score, best_real_score, abs(center - initial[index]), center, best_input)
 			for delta in range(-spec.quantize_radius, spec.quantize_radius + 1):
@@ -78,7 +79,7 @@ def search(spec, coefficients, sample_count=16385):
 				candidate = best[:]
 				candidate[index] = candidate_value
 				score, worst_input = _objective(spec, candidate, raw_inputs, oracle)
-				real_score = _real_objective(candidate, scale, real_samples)
+				real_score = _real_objective(candidate, scale, real_samples, spec.odd)
 				evaluations += 1
 				key = (score, real_score, abs(candidate_value - initial[index]), candidate_value, worst_input)
 				if key < local_best:
@@ -22,16 +22,21 @@ def evaluate(coefficients, x):
 	return result
 
 
-def _solve(function, references, powers):
-	matrix = mp.matrix(len(references), len(powers) + 1)
+def _solve(function, references, powers, fixed_constant):
+	# A fixed constant moves to the right-hand side and leaves the power-0 column out.
+	free = powers[1:] if fixed_constant is not None else powers
+	matrix = mp.matrix(len(references), len(free) + 1)
 	rhs = mp.matrix(len(references), 1)
 	for row, x in enumerate(references):
-		for column, power in enumerate(powers):
+		for column, power in enumerate(free):
 			matrix[row, column] = x**power
-		matrix[row, len(powers)] = -1 if row % 2 else 1
-		rhs[row] = function(x)
+		matrix[row, len(free)] = -1 if row % 2 else 1
+		rhs[row] = function(x) - (fixed_constant or 0)
 	solution = mp.lu_solve(matrix, rhs)
-	return [solution[i] for i in range(len(powers))], solution[len(powers)]
+	coefficients = [solution[i] for i in range(len(free))]
+	if fixed_constant is not None:
+		coefficients.insert(0, fixed_constant)
+	return coefficients, solution[len(free)]
 
 
 def _maximize_abs(error, left, center, right):
@@ -89,14 +94,16 @@ def _select(candidates, count):
 	return max(windows, key=lambda window: min(abs(item[1]) for item in window))
 
 
-def run(function, interval, powers, max_iterations, grid_size, tolerance):
-	count = len(powers) + 1
+def run(function, interval, powers, max_iterations, grid_size, tolerance, fixed_constant=None):
+	count = len(powers) + (1 if fixed_constant is None else 0)
 	a, b = interval
-	references = sorted((a + b) / 2 + (b - a) * mp.cos(mp.pi * j / (count - 1)) / 2 for j in range(count))
+	# The fixed constant is the target's value at z = 0, where the error then vanishes, so that node is dropped.
+	nodes = count + (fixed_constant is not None)
+	references = sorted((a + b) / 2 + (b - a) * mp.cos(mp.pi * j / (nodes - 1)) / 2 for j in range(nodes))[nodes - count :]
 	previous_amplitude = None
 	converged = False
 	for iteration in range(1, max_iterations + 1):
-		coefficients, amplitude = _solve(function, references, powers)
+		coefficients, amplitude = _solve(function, references, powers, fixed_constant)
 		all_extrema = locate_extrema(function, coefficients, interval, grid_size)
 		selected = _select(all_extrema, count)
 		new_references = [item[0] for item in selected]
@@ -113,6 +120,6 @@ def run(function, interval, powers, max_iterations, grid_size, tolerance):
 			break
 		previous_amplitude = abs(amplitude)
 		references = new_references
-	coefficients, amplitude = _solve(function, references, powers)
+	coefficients, amplitude = _solve(function, references, powers, fixed_constant)
 	extrema = _select(locate_extrema(function, coefficients, interval, grid_size), count)
 	return RemezResult(coefficients, amplitude, references, extrema, iteration, converged)
@@ -17,6 +17,10 @@ def _sin_over_x_squared(z: mp.mpf) -> mp.mpf:
 	return mp.sin(x) / x
 
 
+def _cos_of_sqrt(z: mp.mpf) -> mp.mpf:
+	return mp.cos(mp.sqrt(z))
+
+
 def _tan_over_x_squared(z: mp.mpf) -> mp.mpf:
 	if z == 0:
 		return mp.mpf(1)
@@ -39,6 +43,8 @@ def _cot_residual_over_x_squared(z: mp.mpf) -> mp.mpf:
 
 FUNCTIONS: dict[str, Callable[[mp.mpf], mp.mpf]] = {
 	"cot_residual": _cot_residual,
+	"cos": mp.cos,
+	"cos_of_sqrt": _cos_of_sqrt,
 	"cot_residual_over_x_squared": _cot_residual_over_x_squared,
 	"sin": mp.sin,
 	"sin_over_x_squared": _sin_over_x_squared,
@@ -66,6 +72,9 @@ class ApproximationSpec:
 	interval: tuple[mp.mpf, mp.mpf]
 	public_interval: tuple[mp.mpf, mp.mpf]
 	powers: tuple[int, ...]
+	odd: bool
+	fixed_constant: mp.mpf | None
+	scheme: str
 	width: int
 	fraction_bits: int
 	rounding: str
@@ -104,8 +113,13 @@ def load_spec(path: Path) -> ApproximationSpec:
 	if raw["function"] not in FUNCTIONS or raw["reference_function"] not in FUNCTIONS:
 		raise ValueError("function is not present in the reviewed registry")
 	basis = raw["basis"]
-	if basis.get("kind") != "factored" or basis.get("variable") != "x_squared" or basis.get("reconstruction") != "x_times_polynomial":
-		raise ValueError("the first implementation supports x * q(x^2) only")
+	if basis.get("kind") != "factored" or basis.get("variable") != "x_squared" or basis.get("reconstruction") not in ("x_times_polynomial", "polynomial"):
+		raise ValueError("supported bases are x * q(x^2) and q(x^2)")
+	odd = basis["reconstruction"] == "x_times_polynomial"
+	# An even basis may pin q(0), e.g. to keep cos(0) = 1 exact; Remez then fits the rest.
+	fixed_constant = parse_number(basis["fixed_constant"]) if "fixed_constant" in basis else None
+	if fixed_constant is not None and odd:
+		raise ValueError("fixed_constant applies to the even q(x^2) basis only")
 	powers = tuple(basis["powers"])
 	if not powers or powers != tuple(range(len(powers))):
 		raise ValueError("basis powers must be consecutive and start at zero")
@@ -125,14 +139,18 @@ def load_spec(path: Path) -> ApproximationSpec:
 		raise ValueError("invalid reduced interval")
 	if interval[0] != public_interval[0] ** 2 or not mp.almosteq(interval[1], public_interval[1] ** 2):
 		raise ValueError("reduced interval must equal the square of the public interval")
-	if int(raw["degree"]) != 2 * powers[-1] + 1:
+	# The evaluation scheme of q is optional so existing specifications keep meaning Horner.
+	scheme = raw.get("evaluation_scheme", "horner")
+	if scheme not in ("horner", "estrin"):
+		raise ValueError("evaluation_scheme must be horner or estrin")
+	if int(raw["degree"]) != 2 * powers[-1] + odd:
 		raise ValueError("degree does not match the factored basis")
 	if raw["accuracy"].get("unit") != "ulp" or raw["accuracy"].get("objective") != "absolute":
 		raise ValueError("the first implementation accepts an absolute ULP target")
 	return ApproximationSpec(
 		raw=raw,
 		name=raw["name"], target_name=raw["function"], reference_name=raw["reference_function"],
-		interval=(interval[0], interval[1]), public_interval=(public_interval[0], public_interval[1]), powers=powers,
+		interval=(interval[0], interval[1]), public_interval=(public_interval[0], public_interval[1]), powers=powers, odd=odd, fixed_constant=fixed_constant, scheme=scheme,
 		width=q_format["width"], fraction_bits=q_format["fraction_bits"], rounding=raw["rounding_mode"], arithmetic=raw["arithmetic_mode"],
 		precision_digits=int(raw["precision_digits"]), target_ulp=int(raw["accuracy"]["maximum"]),
 		remez_max_iterations=int(raw["remez"]["max_iterations"]), remez_grid_size=int(raw["remez"]["grid_size"]), remez_tolerance=parse_number(raw["remez"]["tolerance"]),
@@ -16,6 +16,7 @@ class VerificationResult:
 	maximum_real_error: mp.mpf
 	worst_real_input: mp.mpf
 	maximum_numerator_bits: int
+	maximum_product_bits: int
 	maximum_stage_raw: int
 	overflow: bool
 
@@ -42,15 +43,17 @@ def verify(spec, raw_coefficients, extrema):
 	maximum_error = -1
 	worst_input = 0
 	maximum_bits = 0
+	maximum_product_bits = 0
 	maximum_stage = 0
 	overflow = False
 	for raw_x in sorted(raw_inputs):
-		evaluation = evaluate_factored(raw_x, raw_coefficients, spec.width, spec.fraction_bits, spec.rounding)
+		evaluation = evaluate_factored(raw_x, raw_coefficients, spec.width, spec.fraction_bits, spec.rounding, spec.odd, spec.scheme)
 		expected = int(mp.nint(spec.reference(mp.mpf(raw_x) / scale) * scale))
 		error = abs(evaluation.raw - expected)
 		if error > maximum_error:
 			maximum_error, worst_input = error, raw_x
 		maximum_bits = max(maximum_bits, evaluation.maximum_numerator_bits)
+		maximum_product_bits = max(maximum_product_bits, evaluation.maximum_product_bits)
 		maximum_stage = max(maximum_stage, evaluation.maximum_stage_raw)
 		overflow = overflow or evaluation.overflow
 	real_coefficients = [mp.mpf(value) / scale for value in raw_coefficients]
@@ -59,8 +62,10 @@ def verify(spec, raw_coefficients, extrema):
 	worst_real_input = mp.mpf(0)
 	for i in range(real_count):
 		x = spec.public_interval[1] * i / (real_count - 1)
-		approximation = x * _poly(real_coefficients, x * x)
+		approximation = _poly(real_coefficients, x * x)
+		if spec.odd:
+			approximation *= x
 		error = abs(approximation - spec.reference(x))
 		if error > maximum_real_error:
 			maximum_real_error, worst_real_input = error, x
-	return VerificationResult("sampled", len(raw_inputs), maximum_error, worst_input, maximum_real_error, worst_real_input, maximum_bits, maximum_stage, overflow)
+	return VerificationResult("sampled", len(raw_inputs), maximum_error, worst_input, maximum_real_error, worst_real_input, maximum_bits, maximum_product_bits, maximum_stage, overflow)
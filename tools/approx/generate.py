@@ -27,7 +27,7 @@ def main() -> int:
 	chebyshev_coefficients, chebyshev_error = initial_fit(spec.target, spec.interval, len(spec.powers))
 	if len(chebyshev_coefficients) != len(spec.powers):
 		raise RuntimeError("unexpected Chebyshev coefficient count")
-	remez = run(spec.target, spec.interval, spec.powers, spec.remez_max_iterations, spec.remez_grid_size, spec.remez_tolerance)
+	remez = run(spec.target, spec.interval, spec.powers, spec.remez_max_iterations, spec.remez_grid_size, spec.remez_tolerance, spec.fixed_constant)
 	if not remez.converged:
 		print("error: Remez exchange did not converge", file=sys.stderr)
 		return 2
@@ -36,6 +36,7 @@ def main() -> int:
 	manifest = emit(args.output, spec, chebyshev_error, remez, quantization, verification)
 	print(f"raw coefficients (Horner order): {manifest['quantization']['raw_coefficients_horner_order']}")
 	print(f"maximum implemented error: {verification.maximum_implemented_error_ulp} ulp ({verification.checked_inputs} inputs checked)")
+	print(f"largest product inside q: {verification.maximum_product_bits} bits")
 	print(f"verification level: {verification.level}")
 	if verification.overflow:
 		print("error: evaluator overflow observed", file=sys.stderr)
@@ -27,6 +27,25 @@ class FixedEvaluatorTests(unittest.TestCase):
 		self.assertFalse(result.overflow)
 		self.assertEqual(evaluate_factored(0, [123, -456, 789], 64, 32, "RoundToEven").raw, 0)
 
+	def test_even_factored_evaluator_skips_final_multiply(self):
+		# 1 - x^2 / 2 at x = 0.5.
+		result = evaluate_factored(1 << 31, [1 << 32, -(1 << 31)], 64, 32, "RoundToEven", odd=False)
+		self.assertEqual(result.raw, (1 << 32) - (1 << 29))
+		self.assertEqual(evaluate_factored(0, [1 << 32, 123], 64, 32, "RoundToEven", odd=False).raw, 1 << 32)
+
+	def test_estrin_matches_horner_when_stages_are_exact(self):
+		# At x = 1 every product is exact, so both schemes return the coefficient sum.
+		coefficients = [value << 32 for value in (1, -2, 3, -4, 5, 7)]
+		for count in range(1, len(coefficients) + 1):
+			horner = evaluate_factored(1 << 32, coefficients[:count], 64, 32, "RoundToEven", odd=False)
+			estrin = evaluate_factored(1 << 32, coefficients[:count], 64, 32, "RoundToEven", odd=False, scheme="estrin")
+			self.assertEqual(estrin.raw, sum(coefficients[:count]))
+			self.assertEqual(estrin.raw, horner.raw)
+		# The last level multiplies the carried term 5 + 7 = 12 by x^4 = 1: 12 * 2^64 needs 69 signed bits.
+		self.assertEqual(estrin.maximum_product_bits, 69)
+		with self.assertRaises(ValueError):
+			evaluate_factored(0, coefficients, 64, 32, "RoundToEven", scheme="unknown")
+
 	def test_tan_factored_target_is_regular_at_zero(self):
 		self.assertEqual(FUNCTIONS["tan_over_x_squared"](mp.mpf(0)), 1)
 		x = mp.mpf("0.5")
@@ -74,5 +93,14 @@ class FixedEvaluatorTests(unittest.TestCase):
 		self.assertLess(abs(result.coefficients[1] - 1), mp.mpf("1e-30"))
 
 
+	def test_remez_keeps_fixed_constant(self):
+		# min over a of max |x^2 - a x| on [0, 1] equioscillates at a / 2 and 1: a = 2 sqrt(2) - 2.
+		mp.mp.dps = 50
+		result = run(lambda x: 1 + x * x, (mp.mpf(0), mp.mpf(1)), (0, 1), 10, 256, mp.mpf("1e-35"), mp.mpf(1))
+		self.assertTrue(result.converged)
+		self.assertEqual(result.coefficients[0], 1)
+		self.assertLess(abs(result.coefficients[1] - (2 * mp.sqrt(2) - 2)), mp.mpf("1e-30"))
+
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,94 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Single-core timing of ipow, cbrt, exp2, log2, and pow. Prints nanoseconds per call over
+// fixed pseudo-random inputs, next to chained operator* and the <cmath> double functions.
+// See docs/internals/powers.md.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+#include "fixed.hpp"
+
+namespace {
+
+using fixmath::arithmetic_mode;
+using fixmath::fixed;
+using fixmath::fixed_policy;
+using fixmath::rounding_mode;
+using Q16_16 = fixed<fixed_policy<fixmath::int32_t, 16, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>>;
+using Q32_32 = fixed<fixed_policy<fixmath::int64_t, 32, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>>;
+
+constexpr int REPEATS = 50;
+constexpr std::size_t INPUT_COUNT = 4096;
+
+// Mean time per call; the results are summed so that the calls cannot be dropped.
+template <class T, class F>
+double time_per_call(const std::vector<T>& inputs, F function) {
+	const auto start = std::chrono::steady_clock::now();
+	long double sum = 0;
+	for (int repeat = 0; repeat < REPEATS; ++repeat) {
+		for (const T x : inputs) {
+			if constexpr (std::is_floating_point_v<T>) {
+				sum += function(x);
+			} else {
+				sum += function(x).raw();
+			}
+		}
+	}
+	const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	if (sum == 42) {
+		std::puts("");
+	}
+	return elapsed / (static_cast<double>(REPEATS) * static_cast<double>(inputs.size()));
+}
+
+} // namespace
+
+int main() {
+	std::vector<Q32_32> positive;
+	std::vector<Q32_32> any;
+	std::vector<Q32_32> near_one;
+	std::vector<Q16_16> positive16;
+	std::vector<double> positive_double;
+	using raw16_t = Q16_16::raw_t;
+	using raw32_t = Q32_32::raw_t;
+	std::uint64_t seed = 1;
+	for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+		seed = seed * 6364136223846793005ULL + 1;
+		positive.push_back(Q32_32::from_raw(static_cast<raw32_t>(seed >> 24) + 1));
+		any.push_back(Q32_32::from_raw(static_cast<raw32_t>(seed) >> 30));
+		// [0.5, 1.5), so that ipow and pow stay in range
+		near_one.push_back(Q32_32::from_raw(static_cast<raw32_t>(seed >> 31) + (raw32_t{1} << 31)));
+		positive16.push_back(Q16_16::from_raw(static_cast<raw16_t>(seed >> 44) + 1));
+		positive_double.push_back(static_cast<double>(positive.back()));
+	}
+
+	const Q32_32 exponent(2.5);
+	std::printf("Q32.32 ns per call\n");
+	std::printf("  log2          %6.1f\n", time_per_call(positive, [](Q32_32 x) { return log2(x); }));
+	std::printf("  exp2          %6.1f\n", time_per_call(any, [](Q32_32 x) { return exp2(x); }));
+	std::printf("  cbrt          %6.1f\n", time_per_call(any, [](Q32_32 x) { return cbrt(x); }));
+	std::printf("  ipow(a, 12)   %6.1f\n", time_per_call(near_one, [](Q32_32 x) { return ipow(x, 12); }));
+	std::printf("  ipow(a, -7)   %6.1f\n", time_per_call(near_one, [](Q32_32 x) { return ipow(x, -7); }));
+	std::printf("  pow(a, 2.5)   %6.1f\n", time_per_call(near_one, [exponent](Q32_32 x) { return pow(x, exponent); }));
+	std::printf("  11 x operator* %5.1f\n", time_per_call(near_one, [](Q32_32 x) {
+		Q32_32 power = x;
+		for (int k = 1; k < 12; ++k) {
+			power = power * x;
+		}
+		return power;
+	}));
+	std::printf("Q16.16 ns per call\n");
+	std::printf("  log2          %6.1f\n", time_per_call(positive16, [](Q16_16 x) { return log2(x); }));
+	std::printf("  cbrt          %6.1f\n", time_per_call(positive16, [](Q16_16 x) { return cbrt(x); }));
+	std::printf("double ns per call\n");
+	std::printf("  std::log2     %6.1f\n", time_per_call(positive_double, [](double x) { return std::log2(x); }));
+	std::printf("  std::cbrt     %6.1f\n", time_per_call(positive_double, [](double x) { return std::cbrt(x); }));
+	std::printf("  std::pow      %6.1f\n", time_per_call(positive_double, [](double x) { return std::pow(x, 2.5); }));
+	return 0;
+}
@@ -0,0 +1,255 @@
+﻿/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+// Exhaustive accuracy verifier. Sweeps every raw input of a window through one library
+// function on all cores, compares each result against a long double reference, and
+// prints the maximum error in ULPs with a histogram. See docs/internals/exhaustive-verification.md.
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include "fixed.hpp"
+#include "fixmath_thread.inl"
+
+namespace {
+
+using fixmath::arithmetic_mode;
+using fixmath::fixed;
+using fixmath::fixed_policy;
+using fixmath::rounding_mode;
+using std::int32_t;
+using std::int64_t;
+using std::uint64_t;
+
+using Q16_16 = fixed<fixed_policy<int32_t, 16, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>>;
+using Q32_32 = fixed<fixed_policy<int64_t, 32, arithmetic_mode::SaturationMode, rounding_mode::RoundToEven>>;
+
+// Histogram bucket i counts errors in (BUCKET_LIMITS[i - 1], BUCKET_LIMITS[i]]; the last
+// bucket counts everything larger.
+constexpr long double BUCKET_LIMITS[] = {0.5L, 1, 2, 4, 8, 16, 64, 256, 1024};
+constexpr std::size_t BUCKET_COUNT = std::size(BUCKET_LIMITS) + 1;
+
+struct function_entry {
+	const char* name;
+	const char* format;
+	int fraction_bits;
+	int64_t min_raw;
+	int64_t max_raw;
+	// Default window: count inputs starting at start, stride raws apart.
+	int64_t start;
+	uint64_t count;
+	uint64_t stride;
+	// Returns false when the input lies outside the function's domain.
+	bool (*evaluate)(int64_t raw, int64_t& result);
+	long double (*reference)(long double x);
+};
+
+template <class fixed, auto function>
+bool evaluate_any(int64_t raw, int64_t& result) {
+	result = function(fixed::from_raw(static_cast<typename fixed::raw_t>(raw))).raw();
+	return true;
+}
+
+template <class fixed, auto function>
+bool evaluate_non_negative(int64_t raw, int64_t& result) {
+	if (raw < 0) {
+		return false;
+	}
+	return evaluate_any<fixed, function>(raw, result);
+}
+
+template <class fixed>
+constexpr function_entry make_entry(const char* name, const char* format, int64_t start, uint64_t count, uint64_t stride, bool (*evaluate)(int64_t, int64_t&), long double (*reference)(long double)) {
+	return {name, format, fixed::FRACTION_BITS, fixed::min_sat().raw(), fixed::max_sat().raw(), start, count, stride, evaluate, reference};
+}
+
+constexpr uint64_t ALL_32 = uint64_t{1} << 32;
+
+// Trigonometric functions exist only for Q32.32, so their default window is 2^32 inputs
+// spaced 2^-30 apart, covering [0, 4) and every octant branch up to past pi.
+const function_entry FUNCTIONS[] = {
+	make_entry<Q16_16>("sqrt", "Q16.16", INT32_MIN, ALL_32, 1, evaluate_non_negative<Q16_16, [](Q16_16 a) { return fixmath::sqrt(a); }>, [](long double x) { return std::sqrt(x); }),
+	make_entry<Q16_16>("cbrt", "Q16.16", INT32_MIN, ALL_32, 1, evaluate_any<Q16_16, [](Q16_16 a) { return fixmath::cbrt(a); }>, [](long double x) { return std::cbrt(x); }),
+	make_entry<Q16_16>("exp2", "Q16.16", INT32_MIN, ALL_32, 1, evaluate_any<Q16_16, [](Q16_16 a) { return fixmath::exp2(a); }>, [](long double x) { return std::exp2(x); }),
+	make_entry<Q16_16>("log2", "Q16.16", INT32_MIN, ALL_32, 1, evaluate_non_negative<Q16_16, [](Q16_16 a) { return fixmath::log2(a); }>, [](long double x) { return std::log2(x); }),
+	make_entry<Q32_32>("sin", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::sin(a); }>, [](long double x) { return std::sin(x); }),
+	make_entry<Q32_32>("cos", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::cos(a); }>, [](long double x) { return std::cos(x); }),
+	make_entry<Q32_32>("tan", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::tan(a); }>, [](long double x) { return std::tan(x); }),
+	make_entry<Q32_32>("cot", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::cot(a); }>, [](long double x) { return std::cos(x) / std::sin(x); }),
+	make_entry<Q32_32>("sin_fast", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::sin<fixmath::precision::Fast>(a); }>, [](long double x) { return std::sin(x); }),
+	make_entry<Q32_32>("cos_fast", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::cos<fixmath::precision::Fast>(a); }>, [](long double x) { return std::cos(x); }),
+	make_entry<Q32_32>("tan_fast", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::tan<fixmath::precision::Fast>(a); }>, [](long double x) { return std::tan(x); }),
+	make_entry<Q32_32>("cot_fast", "Q32.32", 0, ALL_32, 4, evaluate_any<Q32_32, [](Q32_32 a) { return fixmath::cot<fixmath::precision::Fast>(a); }>, [](long double x) { return std::cos(x) / std::sin(x); }),
+};
+
+struct sweep_result {
+	uint64_t checked = 0;
+	uint64_t skipped = 0;
+	uint64_t histogram[BUCKET_COUNT] = {};
+	long double max_error = -1;
+	int64_t worst_raw = 0;
+	int64_t worst_result = 0;
+	long double worst_reference = 0;
+
+	void merge(const sweep_result& other) {
+		checked += other.checked;
+		skipped += other.skipped;
+		for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+			histogram[i] += other.histogram[i];
+		}
+		if (other.max_error > max_error) {
+			max_error = other.max_error;
+			worst_raw = other.worst_raw;
+			worst_result = other.worst_result;
+			worst_reference = other.worst_reference;
+		}
+	}
+};
+
+void sweep(const function_entry& function, int64_t start, uint64_t first, uint64_t last, uint64_t stride, sweep_result& result) {
+	const long double scale = std::ldexp(1.0L, function.fraction_bits);
+	for (uint64_t i = first; i < last; ++i) {
+		// Wrapping arithmetic so a window may start anywhere in the raw range.
+		const int64_t raw = static_cast<int64_t>(static_cast<uint64_t>(start) + i * stride);
+		int64_t actual = 0;
+		if (raw < function.min_raw || raw > function.max_raw || !function.evaluate(raw, actual)) {
+			++result.skipped;
+			continue;
+		}
+		// An out-of-range true value is expected to saturate, so measure against the bound.
+		long double expected = function.reference(static_cast<long double>(raw) / scale) * scale;
+		expected = std::fmin(std::fmax(expected, static_cast<long double>(function.min_raw)), static_cast<long double>(function.max_raw));
+		const long double error = std::fabs(static_cast<long double>(actual) - expected);
+		std::size_t bucket = 0;
+		while (bucket < std::size(BUCKET_LIMITS) && error > BUCKET_LIMITS[bucket]) {
+			++bucket;
+		}
+		++result.histogram[bucket];
+		++result.checked;
+		if (error > result.max_error) {
+			result.max_error = error;
+			result.worst_raw = raw;
+			result.worst_result = actual;
+			result.worst_reference = expected;
+		}
+	}
+}
+
+bool parse_signed(const char* text, int64_t& value) {
+	char* end = nullptr;
+	errno = 0;
+	value = std::strtoll(text, &end, 0);
+	return errno == 0 && end != text && *end == '\0';
+}
+
+bool parse_unsigned(const char* text, uint64_t& value) {
+	char* end = nullptr;
+	errno = 0;
+	value = std::strtoull(text, &end, 0);
+	return errno == 0 && end != text && *end == '\0' && text[0] != '-';
+}
+
+int usage() {
+	std::fprintf(stderr,
+	             "usage: fixmath_verify <function> [--start RAW] [--count N] [--stride S] [--threads T] [--max-ulp E]\n"
+	             "functions:");
+	for (const function_entry& function : FUNCTIONS) {
+		std::fprintf(stderr, " %s", function.name);
+	}
+	std::fprintf(stderr, "\n");
+	return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		return usage();
+	}
+	const function_entry* function = nullptr;
+	for (const function_entry& candidate : FUNCTIONS) {
+		if (std::strcmp(candidate.name, argv[1]) == 0) {
+			function = &candidate;
+		}
+	}
+	if (function == nullptr) {
+		return usage();
+	}
+
+	int64_t start = function->start;
+	uint64_t count = function->count;
+	uint64_t stride = function->stride;
+	uint64_t threads = 0;
+	double max_ulp = -1;
+	for (int i = 2; i < argc; ++i) {
+		const bool has_value = i + 1 < argc;
+		bool ok = has_value;
+		if (std::strcmp(argv[i], "--start") == 0 && has_value) {
+			ok = parse_signed(argv[++i], start);
+		} else if (std::strcmp(argv[i], "--count") == 0 && has_value) {
+			ok = parse_unsigned(argv[++i], count);
+		} else if (std::strcmp(argv[i], "--stride") == 0 && has_value) {
+			ok = parse_unsigned(argv[++i], stride) && stride != 0;
+		} else if (std::strcmp(argv[i], "--threads") == 0 && has_value) {
+			ok = parse_unsigned(argv[++i], threads);
+		} else if (std::strcmp(argv[i], "--max-ulp") == 0 && has_value) {
+			char* end = nullptr;
+			max_ulp = std::strtod(argv[++i], &end);
+			ok = *end == '\0' && max_ulp >= 0;
+		} else {
+			ok = false;
+		}
+		if (!ok) {
+			return usage();
+		}
+	}
+
+	// Fixed-size chunks merged in index order keep the report independent of the thread count.
+	constexpr uint64_t CHUNK = uint64_t{1} << 20;
+	const std::size_t chunk_count = static_cast<std::size_t>((count + CHUNK - 1) / CHUNK);
+	std::vector<sweep_result> chunks(chunk_count);
+	const auto begin = std::chrono::steady_clock::now();
+	fixmath::_fm_parallel_for(chunk_count, static_cast<unsigned>(threads), [&](std::size_t chunk) {
+		const uint64_t first = chunk * CHUNK;
+		const uint64_t last = count - first < CHUNK ? count : first + CHUNK;
+		sweep(*function, start, first, last, stride, chunks[chunk]);
+	});
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	sweep_result total;
+	for (const sweep_result& chunk : chunks) {
+		total.merge(chunk);
+	}
+
+	const long double scale = std::ldexp(1.0L, function->fraction_bits);
+	std::printf("function:  %s (%s, saturation, round to even)\n", function->name, function->format);
+	std::printf("window:    start %lld, count %llu, stride %llu\n", static_cast<long long>(start), static_cast<unsigned long long>(count), static_cast<unsigned long long>(stride));
+	std::printf("checked:   %llu (%llu outside the domain)\n", static_cast<unsigned long long>(total.checked), static_cast<unsigned long long>(total.skipped));
+	std::printf("elapsed:   %.1f s\n", seconds);
+	if (total.checked == 0) {
+		return 0;
+	}
+	std::printf("max error: %.6Lf ulp\n", total.max_error);
+	std::printf("worst:     raw %lld (x = %.12Lg), got raw %lld, expected %.3Lf\n", static_cast<long long>(total.worst_raw), static_cast<long double>(total.worst_raw) / scale,
+	            static_cast<long long>(total.worst_result), total.worst_reference);
+	std::printf("histogram:\n");
+	for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+		const double share = 100.0 * static_cast<double>(total.histogram[i]) / static_cast<double>(total.checked);
+		if (i < std::size(BUCKET_LIMITS)) {
+			std::printf("  <= %6.1Lf ulp  %12llu  %8.4f%%\n", BUCKET_LIMITS[i], static_cast<unsigned long long>(total.histogram[i]), share);
+		} else {
+			std::printf("  >  %6.1Lf ulp  %12llu  %8.4f%%\n", BUCKET_LIMITS[i - 1], static_cast<unsigned long long>(total.histogram[i]), share);
+		}
+	}
+	if (max_ulp >= 0 && total.max_error > max_ulp) {
+		std::fprintf(stderr, "error: max error exceeds %g ulp\n", max_ulp);
+		return 1;
+	}
+	return 0;
+}